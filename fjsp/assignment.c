@@ -0,0 +1,405 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas  atribuio de mquinas s operaes com equilbrio de carga.
+ * @file	assignment.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Custo de uma atribuio: quantidade de mquinas * maior carga + carga total
+ *
+ * Equivale a maior carga + carga mdia, ambas em unidades de tempo (a maior carga  um limite inferior do tempo total do plano).
+*/
+static long long getAssignmentCost(int numberOfMachines, int* loads)
+{
+	long long total = 0;
+	int maximum = 0;
+
+	for (int k = 0; k < numberOfMachines; k++)
+	{
+		total += loads[k];
+		maximum = loads[k] > maximum ? loads[k] : maximum;
+	}
+
+	return (long long)numberOfMachines * maximum + total;
+}
+
+
+/**
+ * @brief	Atribuir cada operao  mquina com menor tempo de execuo ponderado pelo preo da mquina
+ * @param	instance	Instncia do problema
+ * @param	prices		Preo de cada mquina (multiplicador da relaxao lagrangiana)
+ * @param	machines	Array onde  guardada a mquina de cada operao
+ * @param	runtimes	Array onde  guardado o tempo de execuo de cada operao
+ * @param	loads		Array onde  guardada a carga de cada mquina
+*/
+static void assignByPrices(Instance* instance, double* prices, int* machines, int* runtimes, int* loads)
+{
+	memset(loads, 0, instance->numberOfMachines * sizeof(int));
+
+	for (int o = 0; o < instance->numberOfOperations; o++)
+	{
+		int bestMachine = -1, bestRuntime = 0;
+		double bestCost = 0;
+
+		for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+		{
+			double cost = instance->eligibleRuntimes[k] * (1.0 + prices[instance->eligibleMachines[k]]);
+
+			if (bestMachine == -1 || cost < bestCost)
+			{
+				bestMachine = instance->eligibleMachines[k];
+				bestRuntime = instance->eligibleRuntimes[k];
+				bestCost = cost;
+			}
+		}
+
+		machines[o] = bestMachine;
+		runtimes[o] = bestRuntime;
+		loads[bestMachine] += bestRuntime;
+	}
+}
+
+
+/**
+ * @brief	Comparar chaves (tempo de execuo mnimo nos 32 bits superiores, ndice da operao nos inferiores) por ordem decrescente
+*/
+static int compareByRuntime_Descending(const void* a, const void* b)
+{
+	long long first = *(const long long*)a;
+	long long second = *(const long long*)b;
+
+	return (first < second) - (first > second);
+}
+
+
+/**
+ * @brief	Atribuir as operaes por ordem decrescente do menor tempo de execuo, cada uma  mquina que menos aumenta o custo
+ * @param	instance	Instncia do problema
+ * @param	keys		Memria auxiliar para a ordenao (tamanho igual  quantidade de operaes)
+ * @param	machines	Array onde  guardada a mquina de cada operao
+ * @param	runtimes	Array onde  guardado o tempo de execuo de cada operao
+ * @param	loads		Array onde  guardada a carga de cada mquina
+*/
+static void assignByLargestFirst(Instance* instance, long long* keys, int* machines, int* runtimes, int* loads)
+{
+	int m = instance->numberOfMachines;
+
+	for (int o = 0; o < instance->numberOfOperations; o++)
+	{
+		int minimum = instance->eligibleRuntimes[instance->eligibleStart[o]];
+
+		for (int k = instance->eligibleStart[o] + 1; k < instance->eligibleStart[o + 1]; k++)
+		{
+			minimum = instance->eligibleRuntimes[k] < minimum ? instance->eligibleRuntimes[k] : minimum;
+		}
+
+		keys[o] = ((long long)minimum << 32) | o;
+	}
+
+	qsort(keys, instance->numberOfOperations, sizeof(long long), compareByRuntime_Descending);
+	memset(loads, 0, m * sizeof(int));
+
+	int maximum = 0;
+
+	for (int i = 0; i < instance->numberOfOperations; i++)
+	{
+		int o = (int)(keys[i] & 0xFFFFFFFF);
+		int bestMachine = -1, bestRuntime = 0;
+		long long bestIncrease = 0;
+
+		for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+		{
+			int machine = instance->eligibleMachines[k];
+			int runtime = instance->eligibleRuntimes[k];
+			int newMaximum = loads[machine] + runtime > maximum ? loads[machine] + runtime : maximum;
+			long long increase = (long long)m * (newMaximum - maximum) + runtime;
+
+			if (bestMachine == -1 || increase < bestIncrease || (increase == bestIncrease && loads[machine] < loads[bestMachine]))
+			{
+				bestMachine = machine;
+				bestRuntime = runtime;
+				bestIncrease = increase;
+			}
+		}
+
+		machines[o] = bestMachine;
+		runtimes[o] = bestRuntime;
+		loads[bestMachine] += bestRuntime;
+		maximum = loads[bestMachine] > maximum ? loads[bestMachine] : maximum;
+	}
+}
+
+
+/**
+ * @brief	Melhorar uma atribuio movendo operaes da mquina com maior carga para outras mquinas elegveis
+ *
+ * Em cada passo  feita a mudana que mais reduz o custo; termina quando nenhuma mudana o reduz ou ao fim de LOAD_BALANCE_MOVES passos,
+ * para que o custo fique limitado a LOAD_BALANCE_MOVES vezes as operaes (e mquinas elegveis) da mquina com maior carga.
+ * As operaes de cada mquina so mantidas em listas ligadas, para que cada passo s percorra as operaes da mquina com maior carga.
+ * @param	instance	Instncia do problema
+ * @param	machines	Mquina de cada operao ( atualizado)
+ * @param	runtimes	Tempo de execuo de cada operao ( atualizado)
+ * @param	loads		Carga de cada mquina ( atualizado)
+ * @param	next		Memria auxiliar (tamanho igual  quantidade de operaes)
+ * @param	previous	Memria auxiliar (tamanho igual  quantidade de operaes)
+ * @param	first		Memria auxiliar (tamanho igual  quantidade de mquinas)
+*/
+static void moveFromBottleneck(Instance* instance, int* machines, int* runtimes, int* loads, int* next, int* previous, int* first)
+{
+	int m = instance->numberOfMachines;
+
+	for (int k = 0; k < m; k++)
+	{
+		first[k] = -1;
+	}
+
+	for (int o = instance->numberOfOperations - 1; o >= 0; o--)
+	{
+		next[o] = first[machines[o]];
+		previous[o] = -1;
+
+		if (first[machines[o]] != -1)
+		{
+			previous[first[machines[o]]] = o;
+		}
+
+		first[machines[o]] = o;
+	}
+
+	int maximumSteps = instance->numberOfOperations < LOAD_BALANCE_MOVES ? instance->numberOfOperations : LOAD_BALANCE_MOVES;
+
+	for (int step = 0; step < maximumSteps; step++)
+	{
+		// mquina com maior carga e as duas maiores cargas das restantes
+		int bottleneck = 0;
+		for (int k = 1; k < m; k++)
+		{
+			bottleneck = loads[k] > loads[bottleneck] ? k : bottleneck;
+		}
+
+		int highest = -1, secondHighest = -1;
+		for (int k = 0; k < m; k++)
+		{
+			if (k == bottleneck)
+			{
+				continue;
+			}
+
+			if (highest == -1 || loads[k] > loads[highest])
+			{
+				secondHighest = highest;
+				highest = k;
+			}
+			else if (secondHighest == -1 || loads[k] > loads[secondHighest])
+			{
+				secondHighest = k;
+			}
+		}
+
+		int bestOperation = -1, bestMachine = -1, bestRuntime = 0;
+		long long bestDelta = 0;
+
+		for (int o = first[bottleneck]; o != -1; o = next[o])
+		{
+			for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+			{
+				int machine = instance->eligibleMachines[k];
+				int runtime = instance->eligibleRuntimes[k];
+
+				if (machine == bottleneck || loads[machine] + runtime >= loads[bottleneck])
+				{
+					continue;
+				}
+
+				// maior carga depois da mudana
+				int other = machine == highest ? secondHighest : highest;
+				int newMaximum = loads[bottleneck] - runtimes[o];
+				newMaximum = loads[machine] + runtime > newMaximum ? loads[machine] + runtime : newMaximum;
+				newMaximum = other != -1 && loads[other] > newMaximum ? loads[other] : newMaximum;
+
+				long long delta = (long long)m * (newMaximum - loads[bottleneck]) + runtime - runtimes[o];
+
+				if (delta < bestDelta)
+				{
+					bestOperation = o;
+					bestMachine = machine;
+					bestRuntime = runtime;
+					bestDelta = delta;
+				}
+			}
+		}
+
+		if (bestOperation == -1)
+		{
+			break;
+		}
+
+		// mover a operao para a lista da nova mquina
+		int o = bestOperation;
+
+		if (previous[o] != -1)
+		{
+			next[previous[o]] = next[o];
+		}
+		else
+		{
+			first[bottleneck] = next[o];
+		}
+
+		if (next[o] != -1)
+		{
+			previous[next[o]] = previous[o];
+		}
+
+		previous[o] = -1;
+		next[o] = first[bestMachine];
+		if (first[bestMachine] != -1)
+		{
+			previous[first[bestMachine]] = o;
+		}
+		first[bestMachine] = o;
+
+		loads[bottleneck] -= runtimes[o];
+		loads[bestMachine] += bestRuntime;
+		machines[o] = bestMachine;
+		runtimes[o] = bestRuntime;
+	}
+}
+
+
+/**
+ * @brief	Atribuir uma mquina a cada operao, equilibrando a carga das mquinas
+ *
+ * Minimiza quantidade de mquinas * maior carga + carga total, uma relaxao de transporte da tabela de execues em que
+ * as operaes so enviadas para as mquinas. Como o tempo de cada operao depende da mquina, o problema no  um fluxo puro,
+ * e  resolvido pela sua relaxao lagrangiana: em cada iterao cada operao vai para a mquina com menor tempo ponderado
+ * pelo preo da mquina, e os preos sobem nas mquinas acima da carga mdia (pesos multiplicativos).
+ * A melhor destas atribuies  comparada com uma atribuio pela maior operao primeiro, e a melhor das duas  melhorada
+ * movendo operaes da mquina com maior carga. Cada iterao percorre a estrutura de elegibilidade (CSR) uma vez.
+ * @param	instance	Instncia do problema
+ * @param	machines	Array onde  guardada a mquina (ndice) de cada operao
+ * @param	runtimes	Array onde  guardado o tempo de execuo de cada operao
+ * @return	Maior carga de uma mquina (ou -1 se no foi possvel atribuir)
+*/
+int assignMachines_LoadBalanced(Instance* instance, int* machines, int* runtimes)
+{
+	if (instance == NULL || machines == NULL || runtimes == NULL)
+	{
+		return -1;
+	}
+
+	int n = instance->numberOfOperations;
+	int m = instance->numberOfMachines;
+
+	for (int o = 0; o < n; o++)
+	{
+		if (instance->eligibleStart[o] == instance->eligibleStart[o + 1])
+		{
+			return -1; // operao sem mquinas elegveis
+		}
+	}
+
+	double* prices = (double*)malloc(m * sizeof(double));
+	int* loads = (int*)malloc(m * sizeof(int));
+	int* candidateLoads = (int*)malloc(m * sizeof(int));
+	int* first = (int*)malloc(m * sizeof(int));
+	int* candidateMachines = (int*)malloc(n * sizeof(int));
+	int* candidateRuntimes = (int*)malloc(n * sizeof(int));
+	int* next = (int*)malloc(n * sizeof(int));
+	int* previous = (int*)malloc(n * sizeof(int));
+	long long* keys = (long long*)malloc(n * sizeof(long long));
+
+	// se no houver memria para alocar
+	if (prices == NULL || loads == NULL || candidateLoads == NULL || first == NULL || candidateMachines == NULL || candidateRuntimes == NULL
+		|| next == NULL || previous == NULL || keys == NULL)
+	{
+		free(prices);
+		free(loads);
+		free(candidateLoads);
+		free(first);
+		free(candidateMachines);
+		free(candidateRuntimes);
+		free(next);
+		free(previous);
+		free(keys);
+		return -1;
+	}
+
+	// relaxao lagrangiana: comea com preos nulos (cada operao na mquina mais rpida)
+	for (int k = 0; k < m; k++)
+	{
+		prices[k] = 0;
+	}
+
+	long long bestCost = -1;
+
+	for (int iteration = 0; iteration < LOAD_BALANCE_ITERATIONS; iteration++)
+	{
+		assignByPrices(instance, prices, candidateMachines, candidateRuntimes, candidateLoads);
+
+		long long cost = getAssignmentCost(m, candidateLoads);
+		if (bestCost == -1 || cost < bestCost)
+		{
+			bestCost = cost;
+			memcpy(machines, candidateMachines, n * sizeof(int));
+			memcpy(runtimes, candidateRuntimes, n * sizeof(int));
+			memcpy(loads, candidateLoads, m * sizeof(int));
+		}
+
+		// subir os preos das mquinas acima da carga mdia (passo decrescente)
+		double average = 0;
+		for (int k = 0; k < m; k++)
+		{
+			average += candidateLoads[k];
+		}
+		average /= m;
+
+		double step = 1.0 / sqrt(iteration + 1.0);
+		for (int k = 0; k < m && average > 0; k++)
+		{
+			prices[k] = (1.0 + prices[k]) * exp(step * (candidateLoads[k] / average - 1.0)) - 1.0;
+			prices[k] = prices[k] > 0 ? prices[k] : 0;
+		}
+	}
+
+	// atribuio pela maior operao primeiro
+	assignByLargestFirst(instance, keys, candidateMachines, candidateRuntimes, candidateLoads);
+
+	if (getAssignmentCost(m, candidateLoads) < bestCost)
+	{
+		memcpy(machines, candidateMachines, n * sizeof(int));
+		memcpy(runtimes, candidateRuntimes, n * sizeof(int));
+		memcpy(loads, candidateLoads, m * sizeof(int));
+	}
+
+	moveFromBottleneck(instance, machines, runtimes, loads, next, previous, first);
+
+	int maximum = 0;
+	for (int k = 0; k < m; k++)
+	{
+		maximum = loads[k] > maximum ? loads[k] : maximum;
+	}
+
+	free(prices);
+	free(loads);
+	free(candidateLoads);
+	free(first);
+	free(candidateMachines);
+	free(candidateRuntimes);
+	free(next);
+	free(previous);
+	free(keys);
+
+	return maximum;
+}
\ No newline at end of file
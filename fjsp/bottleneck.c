@@ -0,0 +1,713 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao escalonamento por shifting bottleneck (mquina gargalo a mquina gargalo).
+ * @file	bottleneck.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Problema de uma mquina (1|r_j|Lmax com tempos de entrega): cada operao tem tempo de libertao (cabea),
+ *			tempo de execuo e tempo de entrega (cauda), e pretende-se minimizar o maior tempo de concluso mais entrega
+*/
+typedef struct OneMachineProblem
+{
+	int count;
+	int* release;
+	int* runtime;
+	int* delivery;
+	int* sequence; // sequncia da ltima construo de Schrage
+	int* completion; // tempo de concluso de cada posio da sequncia
+	int* heap; // memria auxiliar para a construo de Schrage
+	long long* byRelease; // memria auxiliar para a construo de Schrage
+	int* bestSequence;
+	int best; // melhor valor encontrado
+	int nodes; // ns explorados
+} OneMachineProblem;
+
+
+/**
+ * @brief	Estado do shifting bottleneck: atribuio de mquinas fixa e sequncias das mquinas j sequenciadas
+*/
+typedef struct BottleneckState
+{
+	Instance* instance;
+	int* assignedMachine;
+	int* assignedRuntime;
+	int* releaseTime;
+	int* machineReleaseTime;
+	int* nextInMachine; // seguinte na sequncia da mquina (apenas em mquinas sequenciadas, ou -1)
+	int* previousInMachine;
+	bool* sequenced;
+	int* heads; // tempo inicial mais cedo de cada operao (respeitando os tempos de libertao)
+	int* tails; // caminho mais longo desde o fim de cada operao at ao fim do plano
+	int* order;
+	int* pending;
+	int* machineStart; // operaes de cada mquina esto entre machineStart[m] e machineStart[m + 1] - 1 de machineOperations
+	int* machineOperations;
+} BottleneckState;
+
+
+#pragma region problema de uma mquina
+
+/**
+ * @brief	Comparar chaves (tempo de libertao nos 32 bits superiores, ndice da operao nos inferiores)
+*/
+static int compareByRelease(const void* a, const void* b)
+{
+	long long first = *(const long long*)a;
+	long long second = *(const long long*)b;
+
+	return (first > second) - (first < second);
+}
+
+
+/**
+ * @brief	Retirar do heap (mximo pelo tempo de entrega) a operao com maior tempo de entrega
+ * @param	problem		Problema
+ * @param	size		Tamanho do heap ( atualizado)
+ * @return	ndice da operao
+*/
+static int popByDelivery(OneMachineProblem* problem, int* size)
+{
+	int* heap = problem->heap;
+	int top = heap[0];
+	int last = heap[--(*size)];
+	int i = 0;
+
+	while (true)
+	{
+		int child = 2 * i + 1;
+
+		if (child >= *size)
+		{
+			break;
+		}
+
+		if (child + 1 < *size && problem->delivery[heap[child + 1]] > problem->delivery[heap[child]])
+		{
+			child++;
+		}
+
+		if (problem->delivery[last] >= problem->delivery[heap[child]])
+		{
+			break;
+		}
+
+		heap[i] = heap[child];
+		i = child;
+	}
+
+	if (*size > 0)
+	{
+		heap[i] = last;
+	}
+
+	return top;
+}
+
+
+/**
+ * @brief	Inserir uma operao no heap (mximo pelo tempo de entrega)
+ * @param	problem		Problema
+ * @param	size		Tamanho do heap ( atualizado)
+ * @param	job			ndice da operao
+*/
+static void pushByDelivery(OneMachineProblem* problem, int* size, int job)
+{
+	int* heap = problem->heap;
+	int i = (*size)++;
+
+	while (i > 0 && problem->delivery[heap[(i - 1) / 2]] < problem->delivery[job])
+	{
+		heap[i] = heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+
+	heap[i] = job;
+}
+
+
+/**
+ * @brief	Construir uma sequncia pela regra de Schrage: sempre que a mquina fica livre, executar a operao disponvel
+ *			com maior tempo de entrega
+ * @param	problem		Problema (a sequncia e os tempos de concluso ficam em sequence e completion)
+ * @return	Maior tempo de concluso mais entrega da sequncia
+*/
+static int scheduleSchrage(OneMachineProblem* problem)
+{
+	for (int i = 0; i < problem->count; i++)
+	{
+		problem->byRelease[i] = ((long long)problem->release[i] << 32) | i;
+	}
+
+	qsort(problem->byRelease, problem->count, sizeof(long long), compareByRelease);
+
+	int time = 0, next = 0, size = 0, value = 0;
+
+	for (int position = 0; position < problem->count; position++)
+	{
+		if (size == 0 && problem->release[(int)problem->byRelease[next]] > time)
+		{
+			time = problem->release[(int)problem->byRelease[next]];
+		}
+
+		while (next < problem->count && problem->release[(int)problem->byRelease[next]] <= time)
+		{
+			pushByDelivery(problem, &size, (int)problem->byRelease[next++]);
+		}
+
+		int job = popByDelivery(problem, &size);
+		time += problem->runtime[job];
+
+		problem->sequence[position] = job;
+		problem->completion[position] = time;
+
+		if (time + problem->delivery[job] > value)
+		{
+			value = time + problem->delivery[job];
+		}
+	}
+
+	return value;
+}
+
+
+/**
+ * @brief	Explorar um n da pesquisa em rvore de Carlier para o problema de uma mquina
+ *
+ * A sequncia de Schrage do n tem um caminho crtico de a at b. Se existir no caminho uma operao c com tempo de entrega
+ * menor do que o de b, c interfere com as operaes K entre c e b: num ramo c  executada depois de K (aumenta o seu tempo
+ * de libertao) e no outro antes de K (aumenta o seu tempo de entrega). Caso contrrio, a sequncia  tima para o n.
+ * @param	problem		Problema
+ * @param	lowerBound	Limite inferior do n
+*/
+static void branchCarlier(OneMachineProblem* problem, int lowerBound)
+{
+	if (problem->nodes++ >= SHIFTING_BOTTLENECK_NODE_LIMIT)
+	{
+		return;
+	}
+
+	int value = scheduleSchrage(problem);
+
+	if (value < problem->best)
+	{
+		problem->best = value;
+		memcpy(problem->bestSequence, problem->sequence, problem->count * sizeof(int));
+	}
+
+	// b: ltima operao do caminho crtico
+	int b = problem->count - 1;
+	while (b >= 0 && problem->completion[b] + problem->delivery[problem->sequence[b]] != value)
+	{
+		b--;
+	}
+
+	// a: primeira operao do caminho crtico (bloco sem tempo livre at b)
+	int a = b, sum = 0;
+	for (int i = b; i >= 0; i--)
+	{
+		sum += problem->runtime[problem->sequence[i]];
+
+		if (problem->release[problem->sequence[i]] + sum + problem->delivery[problem->sequence[b]] == value)
+		{
+			a = i;
+		}
+	}
+
+	// c: ltima operao do caminho crtico com tempo de entrega menor do que o de b
+	int c = -1;
+	for (int i = b - 1; i >= a; i--)
+	{
+		if (problem->delivery[problem->sequence[i]] < problem->delivery[problem->sequence[b]])
+		{
+			c = i;
+			break;
+		}
+	}
+
+	if (c == -1)
+	{
+		return;
+	}
+
+	int minimumRelease = problem->release[problem->sequence[c + 1]];
+	int minimumDelivery = problem->delivery[problem->sequence[c + 1]];
+	int totalRuntime = 0;
+
+	for (int i = c + 1; i <= b; i++)
+	{
+		int job = problem->sequence[i];
+
+		minimumRelease = problem->release[job] < minimumRelease ? problem->release[job] : minimumRelease;
+		minimumDelivery = problem->delivery[job] < minimumDelivery ? problem->delivery[job] : minimumDelivery;
+		totalRuntime += problem->runtime[job];
+	}
+
+	int job = problem->sequence[c];
+	int bound = minimumRelease + totalRuntime + minimumDelivery;
+	bound = bound > lowerBound ? bound : lowerBound;
+
+	// ramo 1: c depois de K
+	int oldRelease = problem->release[job];
+	problem->release[job] = oldRelease > minimumRelease + totalRuntime ? oldRelease : minimumRelease + totalRuntime;
+
+	int withJob = (problem->release[job] < minimumRelease ? problem->release[job] : minimumRelease) + totalRuntime + problem->runtime[job]
+		+ (problem->delivery[job] < minimumDelivery ? problem->delivery[job] : minimumDelivery);
+
+	if ((withJob > bound ? withJob : bound) < problem->best)
+	{
+		branchCarlier(problem, withJob > bound ? withJob : bound);
+	}
+
+	problem->release[job] = oldRelease;
+
+	// ramo 2: c antes de K
+	int oldDelivery = problem->delivery[job];
+	problem->delivery[job] = oldDelivery > minimumDelivery + totalRuntime ? oldDelivery : minimumDelivery + totalRuntime;
+
+	withJob = (problem->release[job] < minimumRelease ? problem->release[job] : minimumRelease) + totalRuntime + problem->runtime[job]
+		+ (problem->delivery[job] < minimumDelivery ? problem->delivery[job] : minimumDelivery);
+
+	if ((withJob > bound ? withJob : bound) < problem->best)
+	{
+		branchCarlier(problem, withJob > bound ? withJob : bound);
+	}
+
+	problem->delivery[job] = oldDelivery;
+}
+
+#pragma endregion
+
+
+#pragma region shifting bottleneck
+
+/**
+ * @brief	Calcular as cabeas e as caudas de todas as operaes, com as sequncias das mquinas j sequenciadas
+ * @param	state	Estado do shifting bottleneck
+ * @return	Maior caminho do grafo (ou -1 se as sequncias formarem um ciclo)
+*/
+static int computeHeadsAndTails(BottleneckState* state)
+{
+	Instance* instance = state->instance;
+	int n = instance->numberOfOperations;
+	int head = 0, tail = 0;
+
+	for (int o = 0; o < n; o++)
+	{
+		bool hasJobPrevious = o > instance->jobStart[instance->operationJob[o]];
+
+		state->pending[o] = hasJobPrevious + (state->previousInMachine[o] != -1);
+		state->heads[o] = state->releaseTime[o] > state->machineReleaseTime[state->assignedMachine[o]]
+			? state->releaseTime[o] : state->machineReleaseTime[state->assignedMachine[o]];
+
+		if (state->pending[o] == 0)
+		{
+			state->order[tail++] = o;
+		}
+	}
+
+	while (head < tail)
+	{
+		int o = state->order[head++];
+		int end = state->heads[o] + state->assignedRuntime[o];
+		int jobNext = o + 1 < instance->jobStart[instance->operationJob[o] + 1] ? o + 1 : -1;
+		int successors[2] = { jobNext, state->nextInMachine[o] };
+
+		for (int i = 0; i < 2; i++)
+		{
+			int s = successors[i];
+
+			if (s == -1)
+			{
+				continue;
+			}
+
+			if (end > state->heads[s])
+			{
+				state->heads[s] = end;
+			}
+
+			if (--state->pending[s] == 0)
+			{
+				state->order[tail++] = s;
+			}
+		}
+	}
+
+	if (tail < n)
+	{
+		return -1;
+	}
+
+	int length = 0;
+
+	for (int i = n - 1; i >= 0; i--)
+	{
+		int o = state->order[i];
+		int jobNext = o + 1 < instance->jobStart[instance->operationJob[o] + 1] ? o + 1 : -1;
+		int machineNext = state->nextInMachine[o];
+
+		state->tails[o] = 0;
+
+		if (jobNext != -1 && state->assignedRuntime[jobNext] + state->tails[jobNext] > state->tails[o])
+		{
+			state->tails[o] = state->assignedRuntime[jobNext] + state->tails[jobNext];
+		}
+
+		if (machineNext != -1 && state->assignedRuntime[machineNext] + state->tails[machineNext] > state->tails[o])
+		{
+			state->tails[o] = state->assignedRuntime[machineNext] + state->tails[machineNext];
+		}
+
+		if (state->heads[o] + state->assignedRuntime[o] + state->tails[o] > length)
+		{
+			length = state->heads[o] + state->assignedRuntime[o] + state->tails[o];
+		}
+	}
+
+	return length;
+}
+
+
+/**
+ * @brief	Fixar (ou retirar, se sequence for NULL) a sequncia de uma mquina
+ * @param	state		Estado do shifting bottleneck
+ * @param	machine		ndice da mquina
+ * @param	sequence	Operaes da mquina pela ordem de execuo (ou NULL)
+*/
+static void setSequence(BottleneckState* state, int machine, int* sequence)
+{
+	int count = state->machineStart[machine + 1] - state->machineStart[machine];
+	int previous = -1;
+
+	for (int i = 0; i < count; i++)
+	{
+		int o = sequence == NULL ? state->machineOperations[state->machineStart[machine] + i] : sequence[i];
+
+		state->previousInMachine[o] = sequence == NULL ? -1 : previous;
+		state->nextInMachine[o] = -1;
+
+		if (sequence != NULL && previous != -1)
+		{
+			state->nextInMachine[previous] = o;
+		}
+
+		previous = o;
+	}
+
+	state->sequenced[machine] = sequence != NULL;
+}
+
+
+/**
+ * @brief	Resolver o problema de uma mquina com as cabeas e caudas atuais (a mquina no pode estar sequenciada)
+ * @param	state		Estado do shifting bottleneck
+ * @param	problem		Memria para o problema (com capacidade para as operaes da mquina)
+ * @param	machine		ndice da mquina
+ * @param	sequence	Array onde  guardada a melhor sequncia (ndices das operaes)
+ * @return	Maior tempo de concluso mais entrega da melhor sequncia
+*/
+static int solveMachine(BottleneckState* state, OneMachineProblem* problem, int machine, int* sequence)
+{
+	int first = state->machineStart[machine];
+	problem->count = state->machineStart[machine + 1] - first;
+
+	if (problem->count == 0)
+	{
+		return 0;
+	}
+
+	for (int i = 0; i < problem->count; i++)
+	{
+		int o = state->machineOperations[first + i];
+
+		problem->release[i] = state->heads[o];
+		problem->runtime[i] = state->assignedRuntime[o];
+		problem->delivery[i] = state->tails[o];
+	}
+
+	problem->best = 0x7FFFFFFF;
+	problem->nodes = 0;
+	branchCarlier(problem, 0);
+
+	for (int i = 0; i < problem->count; i++)
+	{
+		sequence[i] = state->machineOperations[first + problem->bestSequence[i]];
+	}
+
+	return problem->best;
+}
+
+
+/**
+ * @brief	Voltar a sequenciar uma mquina j sequenciada, com as sequncias das restantes fixas
+ * @param	state		Estado do shifting bottleneck
+ * @param	problem		Memria para o problema
+ * @param	machine		ndice da mquina
+ * @param	sequence	Memria auxiliar para a sequncia
+ * @param	backup		Memria auxiliar para a sequncia anterior
+*/
+static void reoptimizeMachine(BottleneckState* state, OneMachineProblem* problem, int machine, int* sequence, int* backup)
+{
+	int count = state->machineStart[machine + 1] - state->machineStart[machine];
+	if (count == 0)
+	{
+		return;
+	}
+
+	// guardar a sequncia atual (a partir da primeira operao da mquina)
+	int o = state->machineOperations[state->machineStart[machine]];
+	while (state->previousInMachine[o] != -1)
+	{
+		o = state->previousInMachine[o];
+	}
+
+	for (int i = 0; o != -1; i++, o = state->nextInMachine[o])
+	{
+		backup[i] = o;
+	}
+
+	int length = computeHeadsAndTails(state);
+
+	setSequence(state, machine, NULL);
+	computeHeadsAndTails(state);
+	solveMachine(state, problem, machine, sequence);
+	setSequence(state, machine, sequence);
+
+	int newLength = computeHeadsAndTails(state);
+
+	if (newLength < 0 || newLength > length) // se criar um ciclo ou piorar o plano, manter a sequncia anterior
+	{
+		setSequence(state, machine, backup);
+	}
+}
+
+
+/**
+ * @brief	Resolver o escalonamento por shifting bottleneck (verso flexvel, com a atribuio de mquinas fixa)
+ *
+ * A atribuio de mquinas  a do plano recebido (ou a de equilbrio de carga, se o plano no estiver completo). Em cada iterao,
+ * para cada mquina ainda por sequenciar  resolvido o problema de uma mquina com as cabeas e caudas do grafo atual,
+ * por pesquisa em rvore de Carlier (limitada a SHIFTING_BOTTLENECK_NODE_LIMIT ns). A mquina com o maior valor (a gargalo)
+ *  sequenciada e as mquinas j sequenciadas so reotimizadas uma a uma, mantendo cada nova sequncia apenas se no piorar o plano
+ * (no fim, em SHIFTING_BOTTLENECK_FINAL_PASSES passagens). O resultado  sempre o mesmo para os mesmos dados.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano com a atribuio inicial, onde  guardado o plano final
+ * @return	Tempo total do plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_ShiftingBottleneck(Instance* instance, Schedule* schedule)
+{
+	if (instance == NULL || schedule == NULL)
+	{
+		return -1;
+	}
+
+	// sem plano completo, a atribuio inicial  a de equilbrio de carga
+	if (schedule->numberOfScheduled < instance->numberOfOperations)
+	{
+		int* machines = (int*)malloc(instance->numberOfOperations * sizeof(int));
+		int* runtimes = (int*)malloc(instance->numberOfOperations * sizeof(int));
+
+		bool assigned = machines != NULL && runtimes != NULL && assignMachines_LoadBalanced(instance, machines, runtimes) >= 0
+			&& buildSchedule_Assigned(instance, schedule, machines, runtimes) >= 0;
+
+		free(machines);
+		free(runtimes);
+
+		if (!assigned)
+		{
+			return -1;
+		}
+	}
+
+	int n = instance->numberOfOperations;
+	int m = instance->numberOfMachines;
+
+	BottleneckState state;
+	state.instance = instance;
+	state.assignedMachine = schedule->assignedMachine;
+	state.assignedRuntime = schedule->assignedRuntime;
+	state.releaseTime = schedule->releaseTime;
+	state.machineReleaseTime = schedule->machineReleaseTime;
+	state.nextInMachine = (int*)malloc(n * sizeof(int));
+	state.previousInMachine = (int*)malloc(n * sizeof(int));
+	state.sequenced = (bool*)calloc(m, sizeof(bool));
+	state.heads = (int*)malloc(n * sizeof(int));
+	state.tails = (int*)malloc(n * sizeof(int));
+	state.order = (int*)malloc(n * sizeof(int));
+	state.pending = (int*)malloc(n * sizeof(int));
+	state.machineStart = (int*)calloc(m + 1, sizeof(int));
+	state.machineOperations = (int*)malloc(n * sizeof(int));
+
+	OneMachineProblem problem;
+	problem.release = (int*)malloc(n * sizeof(int));
+	problem.runtime = (int*)malloc(n * sizeof(int));
+	problem.delivery = (int*)malloc(n * sizeof(int));
+	problem.sequence = (int*)malloc(n * sizeof(int));
+	problem.completion = (int*)malloc(n * sizeof(int));
+	problem.heap = (int*)malloc(n * sizeof(int));
+	problem.byRelease = (long long*)malloc(n * sizeof(long long));
+	problem.bestSequence = (int*)malloc(n * sizeof(int));
+
+	int* sequence = (int*)malloc(n * sizeof(int));
+	int* backup = (int*)malloc(n * sizeof(int));
+	int* bestSequence = (int*)malloc(n * sizeof(int));
+	int* sequencedOrder = (int*)malloc(m * sizeof(int));
+
+	int makespan = -1;
+
+	if (state.nextInMachine != NULL && state.previousInMachine != NULL && state.sequenced != NULL && state.heads != NULL && state.tails != NULL
+		&& state.order != NULL && state.pending != NULL && state.machineStart != NULL && state.machineOperations != NULL
+		&& problem.release != NULL && problem.runtime != NULL && problem.delivery != NULL && problem.sequence != NULL && problem.completion != NULL
+		&& problem.heap != NULL && problem.byRelease != NULL && problem.bestSequence != NULL
+		&& sequence != NULL && backup != NULL && bestSequence != NULL && sequencedOrder != NULL)
+	{
+		// operaes de cada mquina (formato CSR), pela ordem dos ndices
+		for (int o = 0; o < n; o++)
+		{
+			state.machineStart[state.assignedMachine[o] + 1]++;
+			state.nextInMachine[o] = -1;
+			state.previousInMachine[o] = -1;
+		}
+
+		for (int k = 0; k < m; k++)
+		{
+			state.machineStart[k + 1] += state.machineStart[k];
+		}
+
+		for (int o = 0; o < n; o++)
+		{
+			state.machineOperations[state.machineStart[state.assignedMachine[o]]++] = o;
+		}
+
+		for (int k = m; k > 0; k--)
+		{
+			state.machineStart[k] = state.machineStart[k - 1];
+		}
+		state.machineStart[0] = 0;
+
+		for (int iteration = 0; iteration < m; iteration++)
+		{
+			computeHeadsAndTails(&state);
+
+			// escolher a mquina gargalo entre as que ainda no foram sequenciadas
+			int bottleneck = -1, bottleneckValue = -1;
+
+			for (int k = 0; k < m; k++)
+			{
+				if (state.sequenced[k])
+				{
+					continue;
+				}
+
+				int value = solveMachine(&state, &problem, k, sequence);
+
+				if (value > bottleneckValue)
+				{
+					bottleneck = k;
+					bottleneckValue = value;
+					memcpy(bestSequence, sequence, (state.machineStart[k + 1] - state.machineStart[k]) * sizeof(int));
+				}
+			}
+
+			setSequence(&state, bottleneck, bestSequence);
+
+			if (computeHeadsAndTails(&state) < 0) // se criar um ciclo, sequenciar pela ordem das cabeas atuais
+			{
+				setSequence(&state, bottleneck, NULL);
+				computeHeadsAndTails(&state);
+
+				// ordem topolgica do grafo atual, que nunca cria ciclos
+				int position = 0;
+				for (int i = 0; i < n; i++)
+				{
+					if (state.assignedMachine[state.order[i]] == bottleneck)
+					{
+						bestSequence[position++] = state.order[i];
+					}
+				}
+
+				setSequence(&state, bottleneck, bestSequence);
+			}
+
+			sequencedOrder[iteration] = bottleneck;
+
+			// reotimizar as mquinas j sequenciadas (no fim, todas as mquinas em vrias passagens)
+			int passes = iteration == m - 1 ? SHIFTING_BOTTLENECK_FINAL_PASSES : 1;
+
+			for (int pass = 0; pass < passes; pass++)
+			{
+				for (int i = 0; i <= iteration; i++)
+				{
+					reoptimizeMachine(&state, &problem, sequencedOrder[i], sequence, backup);
+				}
+			}
+		}
+
+		// construir o plano com as sequncias encontradas
+		for (int k = 0; k < m; k++)
+		{
+			schedule->firstInMachine[k] = -1;
+			schedule->lastInMachine[k] = -1;
+		}
+
+		computeHeadsAndTails(&state);
+
+		for (int i = 0; i < n; i++)
+		{
+			int o = state.order[i];
+
+			if (state.previousInMachine[o] == -1)
+			{
+				schedule->firstInMachine[state.assignedMachine[o]] = o;
+			}
+
+			if (state.nextInMachine[o] == -1)
+			{
+				schedule->lastInMachine[state.assignedMachine[o]] = o;
+			}
+		}
+
+		memcpy(schedule->nextInMachine, state.nextInMachine, n * sizeof(int));
+		memcpy(schedule->previousInMachine, state.previousInMachine, n * sizeof(int));
+		schedule->fingerprint = getFingerprint_OfSchedule(schedule);
+
+		makespan = evaluateSchedule(instance, schedule);
+	}
+
+	free(state.nextInMachine);
+	free(state.previousInMachine);
+	free(state.sequenced);
+	free(state.heads);
+	free(state.tails);
+	free(state.order);
+	free(state.pending);
+	free(state.machineStart);
+	free(state.machineOperations);
+	free(problem.release);
+	free(problem.runtime);
+	free(problem.delivery);
+	free(problem.sequence);
+	free(problem.completion);
+	free(problem.heap);
+	free(problem.byRelease);
+	free(problem.bestSequence);
+	free(sequence);
+	free(backup);
+	free(bestSequence);
+	free(sequencedOrder);
+
+	return makespan;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,346 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas a threads, excluso mtua, variveis de condio e operaes atmicas, para Windows e sistemas POSIX.
+ * @file	concurrency.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "data-types.h"
+#include "concurrency.h"
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+
+#pragma region threads
+
+/**
+ * @brief	Dados para iniciar uma thread (a funo e o respetivo argumento)
+*/
+typedef struct ThreadStart
+{
+	ThreadFunction function;
+	void* argument;
+} ThreadStart;
+
+
+/**
+ * @brief	Ponto de entrada comum das threads, que chama a funo pretendida e liberta os dados de incio
+ * @param	data	Dados de incio da thread
+ * @return	Valor de sada da thread
+*/
+#ifdef _WIN32
+static DWORD WINAPI runThread(LPVOID data)
+#else
+static void* runThread(void* data)
+#endif
+{
+	ThreadStart start = *(ThreadStart*)data;
+	free(data);
+
+	start.function(start.argument);
+
+	return 0;
+}
+
+
+/**
+ * @brief	Criar e iniciar uma nova thread
+ * @param	thread		Apontador onde  guardada a thread criada
+ * @param	function	Funo executada pela thread
+ * @param	argument	Argumento passado  funo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool startThread(Thread* thread, ThreadFunction function, void* argument)
+{
+	ThreadStart* start = (ThreadStart*)malloc(sizeof(ThreadStart));
+	if (start == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	start->function = function;
+	start->argument = argument;
+
+#ifdef _WIN32
+	*thread = CreateThread(NULL, 0, runThread, start, 0, NULL);
+	if (*thread == NULL)
+#else
+	if (pthread_create(thread, NULL, runThread, start) != 0)
+#endif
+	{
+		free(start);
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Esperar que uma thread termine
+ * @param	thread	Thread
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool joinThread(Thread thread)
+{
+#ifdef _WIN32
+	bool joined = WaitForSingleObject(thread, INFINITE) == WAIT_OBJECT_0;
+	CloseHandle(thread);
+
+	return joined;
+#else
+	return pthread_join(thread, NULL) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Obter a quantidade de processadores lgicos disponveis
+ * @return	Quantidade de processadores (pelo menos 1)
+*/
+int getNumberOfProcessors()
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	int processors = (int)info.dwNumberOfProcessors;
+#else
+	int processors = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+	return processors > 0 ? processors : 1;
+}
+
+#pragma endregion
+
+
+#pragma region excluso mtua
+
+/**
+ * @brief	Iniciar um mutex
+ * @param	mutex	Apontador para o mutex
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool newMutex(Mutex* mutex)
+{
+#ifdef _WIN32
+	InitializeCriticalSection(mutex);
+	return true;
+#else
+	return pthread_mutex_init(mutex, NULL) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Bloquear um mutex, esperando se estiver bloqueado por outra thread
+ * @param	mutex	Apontador para o mutex
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool lockMutex(Mutex* mutex)
+{
+#ifdef _WIN32
+	EnterCriticalSection(mutex);
+	return true;
+#else
+	return pthread_mutex_lock(mutex) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Desbloquear um mutex
+ * @param	mutex	Apontador para o mutex
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool unlockMutex(Mutex* mutex)
+{
+#ifdef _WIN32
+	LeaveCriticalSection(mutex);
+	return true;
+#else
+	return pthread_mutex_unlock(mutex) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Libertar os recursos de um mutex
+ * @param	mutex	Apontador para o mutex
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanMutex(Mutex* mutex)
+{
+#ifdef _WIN32
+	DeleteCriticalSection(mutex);
+	return true;
+#else
+	return pthread_mutex_destroy(mutex) == 0;
+#endif
+}
+
+#pragma endregion
+
+
+#pragma region variveis de condio
+
+/**
+ * @brief	Iniciar uma varivel de condio
+ * @param	condition	Apontador para a varivel de condio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool newCondition(Condition* condition)
+{
+#ifdef _WIN32
+	InitializeConditionVariable(condition);
+	return true;
+#else
+	return pthread_cond_init(condition, NULL) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Esperar por uma varivel de condio, libertando o mutex enquanto espera
+ *
+ * O mutex tem de estar bloqueado e volta a estar bloqueado no fim. A espera pode terminar sem aviso,
+ * por isso a condio tem de ser verificada de novo num ciclo.
+ * @param	condition	Apontador para a varivel de condio
+ * @param	mutex		Apontador para o mutex bloqueado
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool waitCondition(Condition* condition, Mutex* mutex)
+{
+#ifdef _WIN32
+	return SleepConditionVariableCS(condition, mutex, INFINITE) != 0;
+#else
+	return pthread_cond_wait(condition, mutex) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Acordar todas as threads  espera de uma varivel de condio
+ * @param	condition	Apontador para a varivel de condio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool broadcastCondition(Condition* condition)
+{
+#ifdef _WIN32
+	WakeAllConditionVariable(condition);
+	return true;
+#else
+	return pthread_cond_broadcast(condition) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Libertar os recursos de uma varivel de condio
+ * @param	condition	Apontador para a varivel de condio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanCondition(Condition* condition)
+{
+#ifdef _WIN32
+	return true; // no Windows, as variveis de condio no tm recursos a libertar
+#else
+	return pthread_cond_destroy(condition) == 0;
+#endif
+}
+
+#pragma endregion
+
+
+#pragma region operaes atmicas
+
+/**
+ * @brief	Ler um valor partilhado entre threads
+ * @param	value	Apontador para o valor
+ * @return	Valor lido
+*/
+int loadAtomic(volatile int* value)
+{
+#ifdef _WIN32
+	return (int)InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+#else
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+/**
+ * @brief	Escrever um valor partilhado entre threads
+ * @param	value		Apontador para o valor
+ * @param	newValue	Novo valor
+*/
+void storeAtomic(volatile int* value, int newValue)
+{
+#ifdef _WIN32
+	InterlockedExchange((volatile LONG*)value, newValue);
+#else
+	__atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+#endif
+}
+
+
+/**
+ * @brief	Substituir um valor partilhado apenas se ainda tiver o valor esperado
+ * @param	value		Apontador para o valor
+ * @param	expected	Valor esperado
+ * @param	desired		Novo valor
+ * @return	Booleano para o resultado da funo (se substituiu ou no)
+*/
+bool compareExchangeAtomic(volatile int* value, int expected, int desired)
+{
+#ifdef _WIN32
+	return InterlockedCompareExchange((volatile LONG*)value, desired, expected) == expected;
+#else
+	return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+/**
+ * @brief	Somar a um valor partilhado
+ * @param	value	Apontador para o valor
+ * @param	add		Valor a somar
+ * @return	Valor antes da soma
+*/
+int fetchAddAtomic(volatile int* value, int add)
+{
+#ifdef _WIN32
+	return (int)InterlockedExchangeAdd((volatile LONG*)value, add);
+#else
+	return __atomic_fetch_add(value, add, __ATOMIC_ACQ_REL);
+#endif
+}
+
+
+/**
+ * @brief	Atualizar um valor partilhado com um candidato, se o candidato for menor
+ * @param	value		Apontador para o valor
+ * @param	candidate	Valor candidato
+ * @return	Booleano para o resultado da funo (se atualizou ou no)
+*/
+bool updateMinimumAtomic(volatile int* value, int candidate)
+{
+	int current = loadAtomic(value);
+
+	while (candidate < current)
+	{
+		if (compareExchangeAtomic(value, current, candidate))
+		{
+			return true;
+		}
+
+		current = loadAtomic(value);
+	}
+
+	return false;
+}
+
+#pragma endregion
\ No newline at end of file
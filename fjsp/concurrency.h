@@ -0,0 +1,77 @@
+/**
+ * @brief	Ficheiro com todas as assinaturas e tipos necessrios para a utilizao de threads, excluso mtua, variveis de condio e operaes atmicas (Windows e POSIX).
+ * @file	concurrency.h
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+
+#ifndef CONCURRENCY
+#define CONCURRENCY 1
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#pragma region tipos
+
+#ifdef _WIN32
+typedef HANDLE Thread;
+typedef CRITICAL_SECTION Mutex;
+typedef CONDITION_VARIABLE Condition;
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Condition;
+#endif
+
+/**
+ * @brief	Funo executada por uma thread
+*/
+typedef void (*ThreadFunction)(void* argument);
+
+#pragma endregion
+
+
+#pragma region threads
+
+bool startThread(Thread* thread, ThreadFunction function, void* argument);
+bool joinThread(Thread thread);
+int getNumberOfProcessors();
+
+#pragma endregion
+
+
+#pragma region excluso mtua
+
+bool newMutex(Mutex* mutex);
+bool lockMutex(Mutex* mutex);
+bool unlockMutex(Mutex* mutex);
+bool cleanMutex(Mutex* mutex);
+
+#pragma endregion
+
+
+#pragma region variveis de condio
+
+bool newCondition(Condition* condition);
+bool waitCondition(Condition* condition, Mutex* mutex);
+bool broadcastCondition(Condition* condition);
+bool cleanCondition(Condition* condition);
+
+#pragma endregion
+
+
+#pragma region operaes atmicas
+
+int loadAtomic(volatile int* value);
+void storeAtomic(volatile int* value, int newValue);
+bool compareExchangeAtomic(volatile int* value, int expected, int desired);
+int fetchAddAtomic(volatile int* value, int add);
+bool updateMinimumAtomic(volatile int* value, int candidate);
+
+#pragma endregion
+
+#endif
\ No newline at end of file
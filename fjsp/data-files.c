@@ -0,0 +1,249 @@
+/**
+ * @brief	Ficheiro com todas as funes para guardar nos ficheiros apenas os dados alterados.
+ * @file	data-files.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+// enquanto nenhum ficheiro foi carregado, os dados em memria no correspondem aos ficheiros
+DirtyData dirtyData = { true, true, true, true, true };
+
+// texto de cada posio da tabela hash tal como foi escrito no ficheiro das execues (s existe uma gravao de cada vez)
+static char* executionSections[HASH_TABLE_SIZE] = { NULL };
+static int executionSectionSizes[HASH_TABLE_SIZE] = { 0 };
+static bool executionSectionsValid = false;
+
+
+#pragma region gravao dos dados alterados
+
+/**
+ * @brief	Substituir um ficheiro de dados pelo ficheiro temporrio acabado de escrever
+ * @param	fileName			Nome do ficheiro de dados
+ * @param	temporaryFileName	Nome do ficheiro temporrio
+ * @param	empty				Se no existem dados (o ficheiro  removido, porque um ficheiro em falta  carregado como lista vazia)
+ * @param	written				Se o ficheiro temporrio foi escrito
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool replaceDataFile(char fileName[], char temporaryFileName[], bool empty, bool written)
+{
+	if (empty)
+	{
+		remove(fileName);
+		return true;
+	}
+
+	FILE* file = written ? fopen(temporaryFileName, "r+b") : NULL;
+	bool synced = file != NULL && syncFile(file);
+
+	if (file != NULL)
+	{
+		synced = fclose(file) == 0 && synced;
+	}
+
+	if (!synced || !replaceFile(temporaryFileName, fileName))
+	{
+		remove(temporaryFileName);
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Gerar o texto de uma posio da tabela hash para o ficheiro das execues
+ * @param	node	N (posio) da tabela hash
+ * @param	index	ndice da posio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool buildExecutionSection(ExecutionNode* node, int index)
+{
+	int capacity = node->numberOfExecutions * EXECUTION_LINE_SIZE + 1;
+
+	char* section = (char*)realloc(executionSections[index], capacity);
+	if (section == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	int size = 0;
+
+	for (Execution* current = node->start; current != NULL && size < capacity; current = current->next)
+	{
+		size += snprintf(section + size, capacity - size, "%d;%d;%d\n", current->operationID, current->machineID, current->runtime);
+	}
+
+	executionSections[index] = section;
+	executionSectionSizes[index] = size < capacity ? size : capacity - 1;
+
+	return size < capacity;
+}
+
+
+/**
+ * @brief	Escrever o ficheiro das execues, gerando de novo s o texto das posies da tabela hash alteradas
+ * @param	fileName	Nome do ficheiro
+ * @param	table		Tabela hash das execues de operaes
+ * @param	all			Gerar o texto de todas as posies (a tabela foi criada de novo)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool writeExecutions_Sections(char fileName[], ExecutionNode* table[], bool all)
+{
+	all = all || !executionSectionsValid;
+	executionSectionsValid = false; // s volta a ser vlido se todas as posies forem geradas
+
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		if (all || table[i]->dirty || executionSections[i] == NULL)
+		{
+			if (!buildExecutionSection(table[i], i))
+			{
+				return false;
+			}
+
+			table[i]->dirty = false;
+		}
+	}
+
+	executionSectionsValid = true;
+
+	FILE* file = NULL;
+	if ((file = fopen(fileName, "w")) == NULL) // erro ao abrir o ficheiro
+	{
+		return false;
+	}
+
+	bool written = fprintf(file, "ID da Operao;ID da Mquina;Tempo de Execuo\n") > 0; // escreve o cabealho do .csv
+
+	for (int i = 0; i < HASH_TABLE_SIZE && written; i++)
+	{
+		written = fwrite(executionSections[i], 1, executionSectionSizes[i], file) == (size_t)executionSectionSizes[i];
+	}
+
+	// o fecho tambm tem de funcionar, para garantir que os dados foram escritos
+	written = fclose(file) == 0 && written;
+
+	return written;
+}
+
+
+/**
+ * @brief	Indicar que os dados em memria correspondem aos ficheiros (depois de os carregar)
+ *
+ * O texto guardado das posies da tabela hash deixa de ser vlido, porque a tabela foi carregada de novo.
+ * @param	table	Tabela hash das execues de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool clearDirtyData(ExecutionNode* table[])
+{
+	dirtyData.jobs = false;
+	dirtyData.machines = false;
+	dirtyData.operations = false;
+	dirtyData.executions = false;
+	dirtyData.instance = false;
+
+	if (table != NULL && *table != NULL)
+	{
+		for (int i = 0; i < HASH_TABLE_SIZE; i++)
+		{
+			table[i]->dirty = false;
+		}
+	}
+
+	executionSectionsValid = false;
+
+	return true;
+}
+
+
+/**
+ * @brief	Guardar nos ficheiros .csv e na instncia binria apenas os dados alterados
+ *
+ * Cada ficheiro alterado  escrito num ficheiro temporrio e s depois substitui o original (a instncia binria s quando
+ * mudam os dados que tem, e no apenas nomes). No ficheiro das execues,
+ * s o texto das posies da tabela hash alteradas  gerado de novo, e o restante  reutilizado da gravao anterior.
+ * As indicaes de alterao de cada ficheiro s so retiradas se o ficheiro foi escrito.
+ * @param	jobs		Lista de trabalhos
+ * @param	machines	Lista de mquinas
+ * @param	operations	Lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @param	dirty		Dados alterados desde a ltima gravao
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool writeData_Changed(Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[], DirtyData* dirty)
+{
+	if (dirty == NULL)
+	{
+		return false;
+	}
+
+	bool hasTable = table != NULL && *table != NULL;
+	bool executionsChanged = dirty->executions;
+
+	for (int i = 0; i < HASH_TABLE_SIZE && hasTable && !executionsChanged; i++)
+	{
+		executionsChanged = table[i]->dirty;
+	}
+
+	if (!dirty->jobs && !dirty->machines && !dirty->operations && !dirty->instance && !executionsChanged)
+	{
+		return true; // os ficheiros j correspondem aos dados em memria
+	}
+
+	bool succeeded = true;
+
+	if (dirty->jobs)
+	{
+		dirty->jobs = !replaceDataFile(JOBS_FILENAME_TEXT, JOBS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, jobs == NULL,
+			writeJobs_Text(JOBS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, jobs));
+		succeeded = !dirty->jobs && succeeded;
+	}
+
+	if (dirty->machines)
+	{
+		dirty->machines = !replaceDataFile(MACHINES_FILENAME_TEXT, MACHINES_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, machines == NULL,
+			writeMachines_Text(MACHINES_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, machines));
+		succeeded = !dirty->machines && succeeded;
+	}
+
+	if (dirty->operations)
+	{
+		dirty->operations = !replaceDataFile(OPERATIONS_FILENAME_TEXT, OPERATIONS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, operations == NULL,
+			writeOperations_Text(OPERATIONS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, operations));
+		succeeded = !dirty->operations && succeeded;
+	}
+
+	if (executionsChanged)
+	{
+		// se a escrita falhar, a tabela inteira  escrita de novo na prxima gravao
+		dirty->executions = !replaceDataFile(EXECUTIONS_FILENAME_TEXT, EXECUTIONS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, !hasTable,
+			hasTable && writeExecutions_Sections(EXECUTIONS_FILENAME_TEXT TEMPORARY_FILENAME_SUFFIX, table, dirty->executions));
+		succeeded = !dirty->executions && succeeded;
+	}
+
+	// a instncia compacta, que  carregada rapidamente na opo 30, no tem nomes,
+	// por isso s  reescrita se mudaram identificadores, posies das operaes ou execues
+	if (dirty->instance || executionsChanged)
+	{
+		Instance* instance = newInstance(jobs, machines, operations, table);
+
+		dirty->instance = !replaceDataFile(INSTANCE_FILENAME_BINARY, INSTANCE_FILENAME_BINARY TEMPORARY_FILENAME_SUFFIX, instance == NULL,
+			instance != NULL && writeInstance_Binary(INSTANCE_FILENAME_BINARY TEMPORARY_FILENAME_SUFFIX, instance));
+		succeeded = !dirty->instance && succeeded;
+
+		cleanInstance(&instance);
+	}
+
+	return succeeded;
+}
+
+#pragma endregion
\ No newline at end of file
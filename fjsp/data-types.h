@@ -24,12 +24,88 @@
 #define OPERATIONS_FILENAME_TEXT "text/operations.csv"
 #define EXECUTIONS_FILENAME_TEXT "text/executions.csv"
 #define PLAN_FILENAME_TEXT "text/plan.csv"
+#define PLAN_FILENAME_JSON "text/plan.jsonl"
+#define ARRIVALS_FILENAME_TEXT "text/arrivals.csv"
 
 // nomes para os ficheiros binrios onde os dados so armazenados durante a execuo do programa
 #define JOBS_FILENAME_BINARY "binary/jobs.bin"
 #define MACHINES_FILENAME_BINARY "binary/machines.bin"
 #define OPERATIONS_FILENAME_BINARY "binary/operations.bin"
 #define EXECUTIONS_FILENAME_BINARY "binary/executions.bin"
+#define INSTANCE_FILENAME_BINARY "binary/instance.bin"
+#define PLAN_FILENAME_BINARY "binary/plan.bin"
+#define TEMPORARY_FILENAME_SUFFIX ".tmp" // ficheiro escrito por completo antes de substituir o original
+
+// dirio de alteraes (cada alterao  acrescentada ao fim do ficheiro e reposta ao carregar os dados)
+#define JOURNAL_FILENAME "binary/journal.bin"
+#define JOURNAL_SYNC_BATCH 32 // registos escritos e sincronizados com o disco de uma s vez
+#define JOURNAL_COMPACTION_THRESHOLD 1024 // registos no dirio a partir dos quais os ficheiros so reescritos em segundo plano
+
+// gravao dos dados alterados
+#define EXECUTION_LINE_SIZE 36 // tamanho mximo (em bytes) de uma linha do ficheiro das execues (3 inteiros, 2 separadores e '\n')
+
+// exportao de planos por intervalos de tempo
+#define PLAN_EXPORT_LINE_SIZE 128 // tamanho mximo (em bytes) de uma operao exportada em texto
+#define PLAN_BINARY_MAGIC "FJSPPLAN" // identificao do formato binrio dos planos (8 carateres, sem '\0')
+#define PLAN_BINARY_VERSION 1 // verso do formato binrio dos planos
+
+// formato do ficheiro binrio da instncia compacta (snapshot)
+#define SNAPSHOT_MAGIC "FJSPSNAP" // identificao do formato (8 carateres, sem '\0')
+#define SNAPSHOT_VERSION 1 // verso do formato (incrementar sempre que a estrutura mudar)
+#define SNAPSHOT_BYTE_ORDER 0x01020304 // para detetar ficheiros escritos numa mquina com outra ordem de bytes
+#define SNAPSHOT_SECTIONS 8 // quantidade de arrays da instncia guardados
+#define SNAPSHOT_ALIGNMENT 64 // alinhamento (em bytes) do incio de cada array no ficheiro
+
+// leitura em paralelo do ficheiro .csv das execues
+#define PARSE_CHUNK_MIN_SIZE (1 << 20) // tamanho mnimo (em bytes) da parte do ficheiro lida por cada thread
+
+// parmetros por defeito do escalonamento por iterated greedy
+#define ITERATED_GREEDY_DESTROY_SIZE 4 // quantidade de operaes removidas em cada iterao
+#define ITERATED_GREEDY_TEMPERATURE 0.4f // fator de temperatura para aceitar planos piores
+#define ITERATED_GREEDY_TIME_LIMIT 500 // tempo mximo de procura (em milissegundos)
+
+// parmetros do portflio de algoritmos em paralelo
+#define PORTFOLIO_SLICE_TIME 50 // intervalo (em milissegundos) em que cada thread volta a comparar o seu plano com o melhor partilhado
+#define DETERMINISTIC_ITERATIONS_PER_EPOCH 200 // iteraes de cada thread entre trocas de planos, no modo reprodutvel
+#define DECODE_DEPTH_BUCKETS 10 // intervalos de profundidade (dcimos das operaes) das estatsticas das construes abandonadas
+
+// parmetros da decomposio por horizonte deslizante
+#define ROLLING_HORIZON_WINDOW_SIZE 500 // quantidade de operaes de cada janela
+#define ROLLING_HORIZON_OVERLAP 100 // operaes de cada janela que voltam a ser escalonadas na janela seguinte
+#define ROLLING_HORIZON_ITERATIONS 300 // iteraes do algoritmo em cada janela
+
+// parmetros das impresses digitais dos planos
+#define TABU_MEMORY_SIZE 4096 // quantidade de planos recentes que o iterated greedy no volta a aceitar
+
+// parmetros da frente de Pareto (NSGA-II)
+#define NUMBER_OF_OBJECTIVES 3 // tempo total do plano, carga total e maior carga de uma mquina
+#define PARETO_POPULATION_SIZE 40 // quantidade de planos da populao
+#define PARETO_GENERATIONS 200 // quantidade de geraes
+#define PARETO_ARCHIVE_SIZE 20 // quantidade mxima de planos guardados na frente
+#define PARETO_MUTATION_RATE 0.3f // probabilidade de mutao de cada descendente
+#define PARETO_DUPLICATE_ATTEMPTS 3 // novas mutaes de um descendente que repete um plano da populao
+
+// parmetros do algoritmo memtico
+#define MEMETIC_POPULATION_SIZE 30 // quantidade de planos da populao
+#define MEMETIC_GENERATIONS 100 // quantidade de geraes
+#define MEMETIC_MUTATION_RATE 0.3f // probabilidade de mutao de cada descendente
+#define MEMETIC_LOCAL_SEARCH_BUDGET 16 // movimentos iniciais da procura local de cada descendente
+#define MEMETIC_MIN_BUDGET 4 // limite inferior dos movimentos da procura local
+#define MEMETIC_MAX_BUDGET 256 // limite superior dos movimentos da procura local
+
+// parmetros da atribuio de mquinas com equilbrio de carga
+#define LOAD_BALANCE_ITERATIONS 30 // iteraes da relaxao lagrangiana (cada uma percorre a tabela de execues uma vez)
+#define LOAD_BALANCE_MOVES 256 // mudanas mximas de operaes da mquina com maior carga (cada uma percorre as operaes dessa mquina)
+
+// parmetros do shifting bottleneck
+#define SHIFTING_BOTTLENECK_NODE_LIMIT 500 // quantidade mxima de ns da pesquisa em rvore de cada problema de uma mquina
+#define SHIFTING_BOTTLENECK_FINAL_PASSES 3 // passagens de reotimizao de todas as mquinas depois de sequenciada a ltima
+
+// parmetros da reparao de planos
+#define REPAIR_POLISH_SIZE 16 // quantidade mxima de operaes afetadas que so reinseridas ao polir um plano reparado
+
+// avaliao de cromossomas em lote
+#define DECODE_LANES 16 // cromossomas avaliados em simultneo (uma via por cromossoma; 1 vetor AVX-512, 2 vetores AVX2)
 
 #pragma endregion
 
@@ -93,6 +169,9 @@ typedef struct Operation
 // lista de operaes
 extern Operation* operations;
 
+// verso das operaes, que muda sempre que uma operao  inserida, removida ou muda de trabalho ou de posio
+extern int operationsVersion;
+
 
 /**
  * @brief	Estrutura de dados para representar a lista de execues de operaes em mquinas (em memria)
@@ -108,12 +187,53 @@ typedef struct Execution
 // lista de execues de operaes
 extern Execution* executions;
 
+/**
+ * @brief	Estrutura de dados para representar os agregados dos tempos de execuo de uma operao (mantidos pela tabela hash das execues)
+ *
+ * As mquinas alternativas ficam num array, para que o mnimo e o mximo sejam recalculados apenas a partir delas
+ * quando a execuo removida ou atualizada era o extremo.
+*/
+typedef struct OperationStatistics
+{
+	int operationID;
+	int count; // quantidade de mquinas alternativas
+	int sum; // soma dos tempos de execuo
+	int min; // menor tempo de execuo
+	int max; // maior tempo de execuo
+	int minMachineID; // mquina com o menor tempo de execuo
+	int maxMachineID; // mquina com o maior tempo de execuo
+	int* machineIDs; // mquinas alternativas
+	int* runtimes; // tempo de execuo em cada mquina alternativa
+	int capacity; // capacidade dos arrays das mquinas alternativas
+	struct JobStatistics* job; // agregados do trabalho da operao (ou NULL se ainda no foi associada)
+	int position; // posio da operao no trabalho
+	struct OperationStatistics* next;
+} OperationStatistics;
+
+/**
+ * @brief	Estrutura de dados para representar os agregados dos tempos de execuo de um trabalho (mantidos pela tabela hash das execues)
+ *
+ * Os totais so atualizados sempre que muda o mnimo ou o mximo de uma das operaes, sem percorrer as restantes.
+*/
+typedef struct JobStatistics
+{
+	int jobID;
+	int minTotal; // soma dos menores tempos de execuo das operaes
+	int maxTotal; // soma dos maiores tempos de execuo das operaes
+	int numberOfOperations; // quantidade de operaes com execues
+	OperationStatistics** operations; // agregados das operaes, ordenados pela posio no trabalho
+	struct JobStatistics* next;
+} JobStatistics;
+
 /**
  * @brief	Estrutura de dados para representar cada n (posio) da tabela hash das execues (em memria)
 */
 typedef struct {
 	Execution* start; // apontador para o primeiro elemento de cada posio da tabela
 	int numberOfExecutions; // quantidade de execues de operaes de cada posio da tabela
+	OperationStatistics* statistics; // agregados das operaes cujo identificador d esta posio da tabela
+	JobStatistics* jobs; // agregados dos trabalhos cujo identificador d esta posio da tabela
+	bool dirty; // se a posio foi alterada desde que os dados foram guardados
 } ExecutionNode;
 
 // tabela hash para armazenar as execues e fazer buscas de forma mais eficiente,
@@ -121,6 +241,22 @@ typedef struct {
 extern ExecutionNode* executionsTable[HASH_TABLE_SIZE];
 
 
+/**
+ * @brief	Estrutura de dados para indicar que dados foram alterados desde que foram guardados nos ficheiros
+*/
+typedef struct DirtyData
+{
+	bool jobs;
+	bool machines;
+	bool operations;
+	bool executions; // a tabela inteira (cada posio alterada  indicada no prprio n da tabela)
+	bool instance; // identificadores ou posies guardados na instncia compacta (os nomes no fazem parte dela)
+} DirtyData;
+
+// dados alterados desde que foram guardados
+extern DirtyData dirtyData;
+
+
 /**
  * @brief	Estrutura de dados para guardar as operaes e os restantes dados necessrios que sero utilizados num plano de produo
 */
@@ -151,6 +287,259 @@ extern Cell plan[NUMBER_MACHINES][MAX_TIME];
 #pragma endregion
 
 
+#pragma region estruturas de dados para escalonamento
+
+/**
+ * @brief	Estrutura de dados compacta (em arrays) com uma instncia do problema, construda a partir das listas e da tabela hash
+ *
+ * As operaes so indexadas de 0 a numberOfOperations - 1, agrupadas por trabalho e ordenadas pela posio dentro do trabalho,
+ * ou seja, as operaes do trabalho j esto entre jobStart[j] e jobStart[j + 1] - 1.
+ * As mquinas elegveis de cada operao o esto entre eligibleStart[o] e eligibleStart[o + 1] - 1 (formato CSR).
+*/
+typedef struct Instance
+{
+	int numberOfJobs;
+	int numberOfMachines;
+	int numberOfOperations;
+	int numberOfExecutions;
+	int* jobIDs; // identificador de cada trabalho
+	int* machineIDs; // identificador de cada mquina
+	int* operationIDs; // identificador de cada operao
+	int* operationJob; // ndice do trabalho de cada operao
+	int* jobStart; // ndice da primeira operao de cada trabalho (tamanho numberOfJobs + 1)
+	int* eligibleStart; // ndice da primeira mquina elegvel de cada operao (tamanho numberOfOperations + 1)
+	int* eligibleMachines; // ndice das mquinas elegveis
+	int* eligibleRuntimes; // tempo de execuo em cada mquina elegvel
+	int jobsCapacity; // capacidade dos arrays dos trabalhos (para acrescentar trabalhos sem realocar sempre)
+	int operationsCapacity; // capacidade dos arrays das operaes
+	int executionsCapacity; // capacidade dos arrays das mquinas elegveis
+} Instance;
+
+
+/**
+ * @brief	Estrutura de dados para descrever um array da instncia guardado no ficheiro binrio (snapshot)
+*/
+typedef struct SnapshotSection
+{
+	long long offset; // posio do array no ficheiro (mltipla de SNAPSHOT_ALIGNMENT)
+	long long count; // quantidade de inteiros do array
+	unsigned long long checksum; // soma de verificao dos inteiros do array
+} SnapshotSection;
+
+
+/**
+ * @brief	Estrutura de dados para o cabealho do ficheiro binrio da instncia (snapshot)
+ *
+ * Os arrays so guardados pela ordem: jobIDs, machineIDs, jobStart, operationIDs, operationJob, eligibleStart, eligibleMachines e eligibleRuntimes.
+*/
+typedef struct SnapshotHeader
+{
+	char magic[8]; // SNAPSHOT_MAGIC
+	unsigned int version; // SNAPSHOT_VERSION
+	unsigned int byteOrder; // SNAPSHOT_BYTE_ORDER
+	int numberOfJobs;
+	int numberOfMachines;
+	int numberOfOperations;
+	int numberOfExecutions;
+	int numberOfSections; // SNAPSHOT_SECTIONS
+	int headerSize; // tamanho do cabealho em bytes
+	SnapshotSection sections[SNAPSHOT_SECTIONS];
+	unsigned long long checksum; // soma de verificao do cabealho (sem este campo)
+} SnapshotHeader;
+
+
+/**
+ * @brief	Estrutura de dados para representar um plano de produo por intervalos de tempo
+ *
+ * A sequncia de operaes em cada mquina  uma lista duplamente ligada por ndices (previousInMachine/nextInMachine),
+ * o que permite inserir e remover operaes em tempo constante. Uma operao no escalonada tem assignedMachine igual a -1.
+*/
+typedef struct Schedule
+{
+	int numberOfOperations;
+	int numberOfMachines;
+	int* assignedMachine; // ndice da mquina atribuda a cada operao
+	int* assignedRuntime; // tempo de execuo na mquina atribuda
+	int* startTime; // tempo inicial de cada operao
+	int* endTime; // tempo final de cada operao
+	int* releaseTime; // tempo mnimo para iniciar cada operao (0 por defeito, mantm-se ao limpar o plano), usado para fixar o passado
+	int* previousInMachine; // operao anterior na mesma mquina (ou -1)
+	int* nextInMachine; // operao seguinte na mesma mquina (ou -1)
+	int* previousInJob; // operao escalonada anterior no mesmo trabalho (ou -1), calculada ao avaliar o plano
+	int* nextInJob; // operao escalonada seguinte no mesmo trabalho (ou -1), calculada ao avaliar o plano
+	int* firstInMachine; // primeira operao de cada mquina (ou -1)
+	int* lastInMachine; // ltima operao de cada mquina (ou -1)
+	int* machineReleaseTime; // tempo a partir do qual cada mquina est disponvel (0 por defeito, mantm-se ao limpar o plano)
+	int* order; // ordem topolgica das operaes escalonadas, calculada ao avaliar o plano
+	int* pending; // memria auxiliar para avaliar o plano
+	int numberOfScheduled; // quantidade de operaes escalonadas
+	int makespan; // tempo total do plano
+	int capacity; // capacidade dos arrays das operaes
+	unsigned long long fingerprint; // impresso digital (Zobrist) das decises (operao, mquina, anterior na mquina)
+} Schedule;
+
+
+/**
+ * @brief	Estrutura de dados para representar as estatsticas das construes de planos com limite de tempo total
+ *
+ * Uma construo  abandonada quando o fim de uma operao mais o trabalho mnimo que falta ao seu trabalho chega ao limite.
+ * A profundidade de abandono  a frao das operaes j escalonadas, contada em DECODE_DEPTH_BUCKETS intervalos.
+*/
+typedef struct DecodeStatistics
+{
+	long long decodes; // quantidade de construes iniciadas
+	long long aborted; // quantidade de construes abandonadas
+	long long operations; // operaes que teriam sido escalonadas sem abandonos
+	long long scheduled; // operaes efetivamente escalonadas
+	long long abortedAtDepth[DECODE_DEPTH_BUCKETS]; // construes abandonadas em cada intervalo de profundidade
+} DecodeStatistics;
+
+
+/**
+ * @brief	Estrutura de dados para representar um conjunto de impresses digitais de planos (memria tabu e deteo de repetidos)
+ *
+ * Tabela de disperso com endereamento aberto e, por ordem de insero, uma fila circular: quando a memria fica cheia,
+ * a impresso digital mais antiga  esquecida.
+*/
+typedef struct FingerprintSet
+{
+	unsigned long long* table; // 0 indica um lugar vazio
+	int tableSize; // potncia de 2, pelo menos o dobro da memria
+	unsigned long long* recent; // fila circular pela ordem de insero
+	int memory; // quantidade mxima de impresses digitais guardadas
+	int count;
+	int oldest; // posio da mais antiga na fila
+} FingerprintSet;
+
+
+/**
+ * @brief	Estrutura de dados para representar um arquivo de planos no dominados (frente de Pareto)
+ *
+ * Os objetivos do plano i esto entre objectives[i * NUMBER_OF_OBJECTIVES] e objectives[i * NUMBER_OF_OBJECTIVES + NUMBER_OF_OBJECTIVES - 1],
+ * pela ordem: tempo total do plano, carga total (soma dos tempos de execuo) e maior carga de uma mquina.
+*/
+typedef struct ParetoArchive
+{
+	Schedule** plans;
+	int* objectives;
+	int size;
+	int capacity; // quantidade mxima de planos (os mais prximos dos vizinhos na frente so descartados)
+} ParetoArchive;
+
+
+/**
+ * @brief	Estrutura de dados para representar a chegada de um novo trabalho ao plano em curso (escalonamento online)
+ *
+ * As operaes esto pela ordem de execuo e as mquinas elegveis da operao i esto entre eligibleStart[i] e eligibleStart[i + 1] - 1.
+*/
+typedef struct JobArrival
+{
+	int jobID;
+	int arrivalTime; // instante a partir do qual as operaes podem comear
+	int numberOfOperations;
+	int* operationIDs;
+	int* eligibleStart; // tamanho numberOfOperations + 1
+	int* machineIDs;
+	int* runtimes;
+} JobArrival;
+
+
+/**
+ * @brief	Estado do escalonamento online (definido em online.c)
+*/
+typedef struct OnlineScheduler OnlineScheduler;
+
+
+/**
+ * @brief	Dirio de alteraes aos dados (definido em journal.c)
+*/
+typedef struct Journal Journal;
+
+
+/**
+ * @brief	Estado de uma procura por iterated greedy (definido em iterated-greedy.c)
+*/
+typedef struct IteratedGreedySearch IteratedGreedySearch;
+
+
+/**
+ * @brief	Estado de um gerador de nmeros pseudo-aleatrios baseado num contador (splitmix64)
+*/
+typedef struct Random
+{
+	unsigned long long seed;
+	unsigned long long counter;
+} Random;
+
+
+/**
+ * @brief	Ficheiro mapeado em memria apenas para leitura (o contedo no termina com '\0')
+*/
+typedef struct MappedFile
+{
+	char* data; // contedo do ficheiro (NULL se o ficheiro estiver vazio)
+	long long size; // tamanho do ficheiro em bytes
+} MappedFile;
+
+
+/**
+ * @brief	Funo chamada sempre que um algoritmo de escalonamento encontra um plano melhor (incumbente)
+ *
+ * Recebe a instncia, o novo melhor plano e os dados de contexto indicados por quem iniciou a resoluo.
+ * Deve devolver true para continuar a procura ou false para a terminar.
+*/
+typedef bool (*IncumbentCallback)(Instance* instance, Schedule* incumbent, void* context);
+
+
+/**
+ * @brief	Formatos para exportar um plano por intervalos de tempo
+*/
+typedef enum PlanFormat
+{
+	PLAN_FORMAT_CSV = 0, // uma linha por operao, no mesmo formato do plano exportado pelas listas
+	PLAN_FORMAT_JSON_LINES, // um objeto JSON por linha
+	PLAN_FORMAT_BINARY, // cabealho seguido de 5 inteiros por operao
+	NUMBER_OF_PLAN_FORMATS
+} PlanFormat;
+
+
+/**
+ * @brief	Estrutura de dados para exportar planos para um ficheiro, reutilizando o buffer entre exportaes
+*/
+typedef struct PlanExporter
+{
+	PlanFormat format;
+	char fileName[FILE_LINE_SIZE];
+	char* buffer; // contedo do ficheiro, formatado antes de ser escrito de uma s vez
+	long long capacity; // capacidade do buffer em bytes
+} PlanExporter;
+
+
+/**
+ * @brief	Conjuntos de instrues vetoriais que o processador suporta (detetados quando o programa corre)
+*/
+typedef enum InstructionSet
+{
+	INSTRUCTION_SET_SCALAR = 0, // sem instrues vetoriais (ou processador no x86)
+	INSTRUCTION_SET_AVX2,
+	INSTRUCTION_SET_AVX512
+} InstructionSet;
+
+
+/**
+ * @brief	Algoritmos de escalonamento disponveis para o portflio em paralelo
+*/
+typedef enum SolverEngine
+{
+	ENGINE_ITERATED_GREEDY = 0, // iterated greedy com poucas operaes removidas (intensificao)
+	ENGINE_ITERATED_GREEDY_LARGE, // iterated greedy com mais operaes removidas e temperatura mais alta (diversificao)
+	ENGINE_RANDOMIZED_GREEDY, // reconstrues repetidas pela regra gulosa aleatorizada
+	NUMBER_OF_ENGINES
+} SolverEngine;
+
+#pragma endregion
+
+
 #pragma region estruturas de dados em ficheiros
 
 /**
@@ -209,6 +598,37 @@ typedef struct FileCell
 	struct FileCell* next;
 } FileCell;
 
+
+/**
+ * @brief	Alteraes aos dados registadas no dirio
+ *
+ * Cada registo define o estado final da entidade (e no a diferena), para que repor o mesmo registo mais do que uma vez d o mesmo resultado.
+*/
+typedef enum JournalAction
+{
+	JOURNAL_SET_JOB = 1, // inserir ou atualizar um trabalho
+	JOURNAL_DELETE_JOB, // remover um trabalho, as suas operaes e as respetivas execues
+	JOURNAL_SET_MACHINE, // inserir ou atualizar uma mquina
+	JOURNAL_DELETE_MACHINE, // remover uma mquina e as suas execues
+	JOURNAL_SET_OPERATION, // inserir ou atualizar uma operao (trabalho, posio e nome)
+	JOURNAL_DELETE_OPERATION, // remover uma operao e as suas execues
+	JOURNAL_SET_EXECUTION // inserir ou atualizar o tempo de uma execuo
+} JournalAction;
+
+
+/**
+ * @brief	Estrutura de dados para armazenar em ficheiro um registo do dirio de alteraes
+*/
+typedef struct JournalRecord
+{
+	int action; // JournalAction
+	int first; // identificador do trabalho, da mquina ou da operao (ou operao da execuo)
+	int second; // trabalho da operao ou mquina da execuo
+	int third; // posio da operao ou tempo da execuo
+	char name[NAME_SIZE];
+	unsigned int checksum; // para detetar um registo escrito a meio (por exemplo, se o programa terminou durante a escrita)
+} JournalRecord;
+
 #pragma endregion
 
 #endif
\ No newline at end of file
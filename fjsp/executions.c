@@ -697,6 +697,9 @@ ExecutionNode* newExecutionNode()
 
 	node->start = NULL;
 	node->numberOfExecutions = 0;
+	node->statistics = NULL;
+	node->jobs = NULL;
+	node->dirty = false;
 
 	return node;
 }
@@ -726,6 +729,8 @@ ExecutionNode** newExecutionsTable_Empty(ExecutionNode* table[])
 		}
 	}
 
+	dirtyData.executions = true; // a tabela  criada de novo, por isso o ficheiro  reescrito por completo
+
 	return *table;
 }
 
@@ -741,6 +746,319 @@ int generateHash(int machineID)
 }
 
 
+// tabela (primeira posio) cujos agregados das operaes esto associados aos trabalhos, a lista de operaes e a sua verso
+// usadas nessa associao (s existe uma associao de cada vez)
+static ExecutionNode* jobsTable = NULL;
+static Operation* jobsOperations = NULL;
+static int jobsVersion = 0;
+
+
+/**
+ * @brief	Obter a posio da tabela onde esto os agregados de uma operao (ou de um trabalho)
+ * @param	operationID		Identificador da operao (ou do trabalho)
+ * @return	Posio da tabela
+*/
+static int getStatisticsIndex(int operationID)
+{
+	return ((operationID - 1) % HASH_TABLE_SIZE + HASH_TABLE_SIZE) % HASH_TABLE_SIZE;
+}
+
+
+/**
+ * @brief	Atualizar os totais do trabalho de uma operao depois de mudar o mnimo ou o mximo da operao
+ * @param	statistics	Agregados da operao
+ * @param	oldMin		Mnimo anterior da operao
+ * @param	oldMax		Mximo anterior da operao
+*/
+static void updateJobTotals(OperationStatistics* statistics, int oldMin, int oldMax)
+{
+	if (statistics->job != NULL)
+	{
+		statistics->job->minTotal += statistics->min - oldMin;
+		statistics->job->maxTotal += statistics->max - oldMax;
+	}
+}
+
+
+/**
+ * @brief	Recalcular o mnimo e o mximo de uma operao a partir das suas mquinas alternativas
+ * @param	statistics	Agregados da operao
+*/
+static void refreshExtremes(OperationStatistics* statistics)
+{
+	statistics->min = statistics->count > 0 ? statistics->runtimes[0] : 0;
+	statistics->max = statistics->min;
+	statistics->minMachineID = statistics->count > 0 ? statistics->machineIDs[0] : -1;
+	statistics->maxMachineID = statistics->minMachineID;
+
+	for (int i = 1; i < statistics->count; i++)
+	{
+		if (statistics->runtimes[i] < statistics->min)
+		{
+			statistics->min = statistics->runtimes[i];
+			statistics->minMachineID = statistics->machineIDs[i];
+		}
+
+		if (statistics->runtimes[i] > statistics->max)
+		{
+			statistics->max = statistics->runtimes[i];
+			statistics->maxMachineID = statistics->machineIDs[i];
+		}
+	}
+}
+
+
+/**
+ * @brief	Criar os agregados vazios de uma operao, associados  respetiva posio da tabela
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @return	Agregados criados (ou NULL se no houver memria)
+*/
+static OperationStatistics* newOperationStatistics(ExecutionNode* table[], int operationID)
+{
+	ExecutionNode* node = table[getStatisticsIndex(operationID)];
+
+	OperationStatistics* statistics = (OperationStatistics*)calloc(1, sizeof(OperationStatistics));
+	if (statistics == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	statistics->operationID = operationID;
+	statistics->next = node->statistics;
+	node->statistics = statistics;
+
+	// a nova operao ainda no est associada ao seu trabalho
+	if (table[0] == jobsTable)
+	{
+		jobsTable = NULL;
+	}
+
+	return statistics;
+}
+
+
+/**
+ * @brief	Acrescentar uma mquina alternativa aos agregados de uma operao
+ * @param	statistics	Agregados da operao
+ * @param	execution	Execuo inserida
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool appendExecution_AtStatistics(OperationStatistics* statistics, Execution* execution)
+{
+	if (statistics->count == statistics->capacity)
+	{
+		int capacity = statistics->capacity > 0 ? statistics->capacity * 2 : 4;
+		int* machineIDs = (int*)realloc(statistics->machineIDs, capacity * sizeof(int));
+		if (machineIDs == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+		statistics->machineIDs = machineIDs;
+
+		int* runtimes = (int*)realloc(statistics->runtimes, capacity * sizeof(int));
+		if (runtimes == NULL)
+		{
+			return false;
+		}
+		statistics->runtimes = runtimes;
+		statistics->capacity = capacity;
+	}
+
+	int oldMin = statistics->min, oldMax = statistics->max;
+
+	statistics->machineIDs[statistics->count] = execution->machineID;
+	statistics->runtimes[statistics->count] = execution->runtime;
+	statistics->count++;
+	statistics->sum += execution->runtime;
+
+	if (statistics->count == 1 || execution->runtime < statistics->min)
+	{
+		statistics->min = execution->runtime;
+		statistics->minMachineID = execution->machineID;
+	}
+
+	if (statistics->count == 1 || execution->runtime > statistics->max)
+	{
+		statistics->max = execution->runtime;
+		statistics->maxMachineID = execution->machineID;
+	}
+
+	updateJobTotals(statistics, oldMin, oldMax);
+
+	return true;
+}
+
+
+/**
+ * @brief	Libertar os agregados de uma operao que j no tem mquinas alternativas, desassociando-os da posio da tabela
+ * @param	table			Tabela hash das execues de operaes
+ * @param	statistics		Agregados da operao
+*/
+static void cleanOperationStatistics(ExecutionNode* table[], OperationStatistics* statistics)
+{
+	OperationStatistics** link = &table[getStatisticsIndex(statistics->operationID)]->statistics;
+	while (*link != statistics)
+	{
+		link = &(*link)->next;
+	}
+	*link = statistics->next;
+
+	// o trabalho da operao volta a ser associado s restantes operaes quando for consultado
+	if (table[0] == jobsTable)
+	{
+		jobsTable = NULL;
+	}
+
+	free(statistics->machineIDs);
+	free(statistics->runtimes);
+	free(statistics);
+}
+
+
+/**
+ * @brief	Acrescentar uma execuo aos agregados da sua operao (criados se for a primeira)
+ * @param	table		Tabela hash das execues de operaes
+ * @param	execution	Execuo inserida
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool addExecution_AtStatistics(ExecutionNode* table[], Execution* execution)
+{
+	OperationStatistics* statistics = getOperationStatistics_AtTable(table, execution->operationID);
+
+	if (statistics == NULL)
+	{
+		statistics = newOperationStatistics(table, execution->operationID);
+		if (statistics == NULL)
+		{
+			return false;
+		}
+	}
+
+	if (!appendExecution_AtStatistics(statistics, execution))
+	{
+		if (statistics->count == 0) // os agregados foram criados agora
+		{
+			cleanOperationStatistics(table, statistics);
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Atualizar ou retirar uma mquina alternativa dos agregados de uma operao (os agregados so libertados quando no restam mquinas)
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @param	machineID		Identificador da mquina
+ * @param	runtime			Novo tempo de execuo (ignorado se a mquina for retirada)
+ * @param	removed			Se a mquina  retirada
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool setExecution_AtStatistics(ExecutionNode* table[], int operationID, int machineID, int runtime, bool removed)
+{
+	OperationStatistics* statistics = getOperationStatistics_AtTable(table, operationID);
+	if (statistics == NULL)
+	{
+		return false;
+	}
+
+	int i = 0;
+	while (i < statistics->count && statistics->machineIDs[i] != machineID)
+	{
+		i++;
+	}
+
+	if (i == statistics->count)
+	{
+		return false;
+	}
+
+	int old = statistics->runtimes[i];
+	int oldMin = statistics->min, oldMax = statistics->max;
+
+	if (removed)
+	{
+		statistics->count--;
+		statistics->sum -= old;
+		statistics->machineIDs[i] = statistics->machineIDs[statistics->count];
+		statistics->runtimes[i] = statistics->runtimes[statistics->count];
+	}
+	else
+	{
+		statistics->sum += runtime - old;
+		statistics->runtimes[i] = runtime;
+	}
+
+	if (statistics->count == 0)
+	{
+		if (statistics->job != NULL)
+		{
+			statistics->job->minTotal -= oldMin;
+			statistics->job->maxTotal -= oldMax;
+		}
+
+		cleanOperationStatistics(table, statistics);
+		return true;
+	}
+
+	// s  preciso percorrer as mquinas alternativas quando o extremo mudou
+	if (old == statistics->min || old == statistics->max)
+	{
+		refreshExtremes(statistics);
+	}
+	else if (!removed && runtime < statistics->min)
+	{
+		statistics->min = runtime;
+		statistics->minMachineID = machineID;
+	}
+	else if (!removed && runtime > statistics->max)
+	{
+		statistics->max = runtime;
+		statistics->maxMachineID = machineID;
+	}
+
+	updateJobTotals(statistics, oldMin, oldMax);
+
+	return true;
+}
+
+
+/**
+ * @brief	Atualizar o tempo de uma mquina alternativa nos agregados de uma operao
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @param	machineID		Identificador da mquina
+ * @param	runtime			Novo tempo de execuo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool changeExecution_AtStatistics(ExecutionNode* table[], int operationID, int machineID, int runtime)
+{
+	if (runtime < 0)
+	{
+		return false;
+	}
+
+	return setExecution_AtStatistics(table, operationID, machineID, runtime, false);
+}
+
+
+/**
+ * @brief	Retirar uma mquina alternativa dos agregados de uma operao
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @param	machineID		Identificador da mquina
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool removeExecution_AtStatistics(ExecutionNode* table[], int operationID, int machineID)
+{
+	return setExecution_AtStatistics(table, operationID, machineID, 0, true);
+}
+
+
 /**
  * @brief	Inserir nova execuo na tabela hash das execues de operaes, numa determinada posio
  * @param	table	Tabela hash das execues de operaes
@@ -750,8 +1068,138 @@ ExecutionNode** insertExecution_AtTable(ExecutionNode* table[], Execution* new)
 {
 	int index = generateHash(new->machineID);
 
-	table[index]->start = insertExecution_AtStart_AtList(table[index]->start, new);
+	// se j existir uma execuo com a mesma operao e mquina, a lista da posio fica igual (em vez de ficar vazia)
+	Execution* start = insertExecution_AtStart_AtList(table[index]->start, new);
+	if (start == NULL)
+	{
+		return *table;
+	}
+
+	bool dirty = table[index]->dirty;
+
+	table[index]->start = start;
 	table[index]->numberOfExecutions++;
+	table[index]->dirty = true; // a posio foi alterada desde que foi guardada
+
+	// sem agregados, a execuo  retirada de novo, para que a lista e os agregados continuem a corresponder
+	if (!addExecution_AtStatistics(table, new))
+	{
+		table[index]->start = new->next;
+		table[index]->numberOfExecutions--;
+		table[index]->dirty = dirty;
+		new->next = NULL;
+	}
+
+	return *table;
+}
+
+
+/**
+ * @brief	Misturar dois inteiros numa chave para a tabela de disperso auxiliar da criao da tabela hash em bloco
+ * @param	first	Primeiro inteiro
+ * @param	second	Segundo inteiro
+ * @return	Chave misturada (os bits altos do produto dependem dos dois inteiros)
+*/
+static unsigned int mixKey(int first, int second)
+{
+	unsigned long long key = ((unsigned long long)(unsigned int)first << 32) | (unsigned int)second;
+
+	return (unsigned int)((key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+
+/**
+ * @brief	Criar a tabela hash das execues de operaes de uma s vez, a partir de um array de execues
+ *
+ * As execues repetidas (mesma operao e mesma mquina) so detetadas numa nica passagem por uma tabela de disperso auxiliar
+ * e no so inseridas (prevalece a primeira). Como as restantes so inseridas no incio da lista da sua posio sem percorrer a lista,
+ * a tabela fica igual  que resultaria de inserir as execues uma a uma, mas em tempo linear.
+ * @param	table		Tabela hash das execues de operaes
+ * @param	executions	Array de execues
+ * @param	count		Quantidade de execues
+ * @param	duplicates	Apontador onde  guardada a quantidade de execues repetidas que foram ignoradas (ou NULL)
+ * @return	A tabela hash das execues de operaes criada (ou NULL se no houver memria)
+*/
+ExecutionNode** newExecutionsTable_Bulk(ExecutionNode* table[], Execution* executions, int count, int* duplicates)
+{
+	// iniciar tabela hash vazia
+	*table = newExecutionsTable_Empty(table);
+
+	if (table == NULL || *table == NULL)
+	{
+		return NULL;
+	}
+
+	int size = 2;
+	while (size < 2 * count)
+	{
+		size *= 2;
+	}
+
+	int mask = size - 1;
+	int* pairs = (int*)calloc(size, sizeof(int)); // posio + 1 no array da execuo de cada par (operao, mquina), ou 0 se estiver livre
+	OperationStatistics** operations = (OperationStatistics**)calloc(size, sizeof(OperationStatistics*)); // agregados de cada operao
+	int ignored = 0;
+	bool failed = pairs == NULL || operations == NULL;
+
+	for (int i = 0; i < count && !failed; i++)
+	{
+		int operationID = executions[i].operationID, machineID = executions[i].machineID;
+		int slot = mixKey(operationID, machineID) & mask;
+
+		while (pairs[slot] != 0 && (executions[pairs[slot] - 1].operationID != operationID || executions[pairs[slot] - 1].machineID != machineID))
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		if (pairs[slot] != 0) // repetida
+		{
+			ignored++;
+			continue;
+		}
+
+		pairs[slot] = i + 1;
+
+		Execution* execution = newExecution(operationID, machineID, executions[i].runtime);
+		if (execution == NULL)
+		{
+			failed = true;
+			break;
+		}
+
+		int index = generateHash(machineID);
+		execution->next = table[index]->start;
+		table[index]->start = execution;
+		table[index]->numberOfExecutions++;
+
+		// os agregados da operao so procurados na tabela auxiliar, em vez de percorrer os da posio da tabela hash
+		slot = mixKey(operationID, -1) & mask;
+		while (operations[slot] != NULL && operations[slot]->operationID != operationID)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		if (operations[slot] == NULL)
+		{
+			operations[slot] = newOperationStatistics(table, operationID);
+		}
+
+		failed = operations[slot] == NULL || !appendExecution_AtStatistics(operations[slot], execution);
+	}
+
+	free(pairs);
+	free(operations);
+
+	if (failed)
+	{
+		cleanExecutions_Table((ExecutionNode***)table);
+		return NULL;
+	}
+
+	if (duplicates != NULL)
+	{
+		*duplicates = ignored;
+	}
 
 	return *table;
 }
@@ -762,12 +1210,12 @@ ExecutionNode** insertExecution_AtTable(ExecutionNode* table[], Execution* new)
  * @param	table			Tabela hash das execues de operaes
  * @param	operationID		Identificador da operao
  * @param	machineID		Identificador da mquina
- * @param	runtime			Unidades de tempo
+ * @param	runtime			Unidades de tempo (no pode ser negativo)
  * @return	Booleano para o resultado da funo (se funcionou ou no)
 */
 bool updateRuntime_ByOperation_AtTable(ExecutionNode** table[], int operationID, int machineID, int runtime)
 {
-	if (table == NULL || *table == NULL)
+	if (table == NULL || *table == NULL || runtime < 0)
 	{
 		return false;
 	}
@@ -777,6 +1225,12 @@ bool updateRuntime_ByOperation_AtTable(ExecutionNode** table[], int operationID,
 	int index = generateHash(machineID);
 	bool updated = updateRuntime_AtList(&currentTable[index]->start, operationID, machineID, runtime);
 
+	if (updated)
+	{
+		currentTable[index]->dirty = true;
+		changeExecution_AtStatistics(currentTable, operationID, machineID, runtime);
+	}
+
 	return updated;
 }
 
@@ -816,11 +1270,20 @@ bool deleteExecutions_ByOperation_AtTable(ExecutionNode** table[], int operation
 			if (deleted)
 			{
 				currentTable[i]->numberOfExecutions--;
+				currentTable[i]->dirty = true;
 				deletedAny = true;
 			}
 		} while (deleted);
 	}
 
+	// a operao deixa de ter mquinas alternativas
+	OperationStatistics* statistics = getOperationStatistics_AtTable(currentTable, operationID);
+	while (statistics != NULL && statistics->count > 0)
+	{
+		removeExecution_AtStatistics(currentTable, operationID, statistics->machineIDs[statistics->count - 1]);
+		statistics = getOperationStatistics_AtTable(currentTable, operationID);
+	}
+
 	return deletedAny;
 }
 
@@ -849,6 +1312,15 @@ bool deleteExecutions_ByMachine_AtTable(ExecutionNode** table[], int machineID)
 			continue; // se a posio da tabela estiver vazia, passa para a prxima
 		}
 
+		// retirar a mquina dos agregados das operaes afetadas, antes de apagar as execues
+		for (Execution* current = currentTable[i]->start; current != NULL; current = current->next)
+		{
+			if (current->machineID == machineID)
+			{
+				removeExecution_AtStatistics(currentTable, current->operationID, machineID);
+			}
+		}
+
 		bool deleted;
 
 		do
@@ -860,6 +1332,7 @@ bool deleteExecutions_ByMachine_AtTable(ExecutionNode** table[], int machineID)
 			if (deleted)
 			{
 				currentTable[i]->numberOfExecutions--;
+				currentTable[i]->dirty = true;
 				deletedAny = true;
 			}
 		} while (deleted);
@@ -964,48 +1437,45 @@ ExecutionNode** readExecutions_AtTable_Example(ExecutionNode* table[])
  * @brief	Ler de ficheiro binrio, os registos de todas as execues de operaes para a tabela hash
  * @param	fileName	Nome do ficheiro para ler a lista
  * @param	table		Tabela hash de execues de operaes
+ * @param	duplicates	Apontador onde  guardada a quantidade de execues repetidas que foram ignoradas (ou NULL)
  * @return	A tabela hash de execues de operaes
 */
-ExecutionNode** readExecutions_AtTable_Binary(char fileName[], ExecutionNode* table[])
+ExecutionNode** readExecutions_AtTable_Binary(char fileName[], ExecutionNode* table[], int* duplicates)
 {
-	// iniciar tabela hash vazia
-	*table = newExecutionsTable_Empty(table);
+	Execution* list = readExecutions_AtList_Binary(fileName);
 
-	if (table == NULL || *table == NULL)
+	if (list == NULL) // erro ao ler dados do ficheiro
 	{
 		return NULL;
 	}
 
-	FILE* file = NULL;
-	if ((file = fopen(fileName, "rb")) == NULL) // erro ao abrir o ficheiro
+	int count = 0;
+	for (Execution* current = list; current != NULL; current = current->next)
 	{
-		return NULL;
+		count++;
 	}
 
-	Execution* execution = NULL;
-	Execution* list = NULL;
-	list = readExecutions_AtList_Binary(fileName);
-
-	if (list == NULL) // erro ao ler dados do ficheiro
+	Execution* executions = (Execution*)malloc(count * sizeof(Execution));
+	if (executions == NULL) // se no houver memria para alocar
 	{
+		cleanExecutions_List(&list);
 		return NULL;
 	}
 
-	while (list != NULL) // enquanto que houver dados na lista, guarda-os na tabela
+	// as execues so inseridas pela ordem da lista
+	count = 0;
+	for (Execution* current = list; current != NULL; current = current->next)
 	{
-		execution = newExecution(list->operationID, list->machineID, list->runtime);
-		if (execution == NULL)
-		{
-			fclose(file);
-			return NULL;
-		}
+		executions[count++] = *current;
+	}
 
-		*table = insertExecution_AtTable(table, execution);
+	cleanExecutions_List(&list);
 
-		list = list->next;
-	}
+	ExecutionNode** built = newExecutionsTable_Bulk(table, executions, count, duplicates);
 
-	return *table;
+	free(executions);
+
+	return built;
 }
 
 
@@ -1013,18 +1483,11 @@ ExecutionNode** readExecutions_AtTable_Binary(char fileName[], ExecutionNode* ta
  * @brief Carregar dados das execues de operaes um ficheiro .csv para uma tabela hash em memria
  * @param	fileName	Nome do ficheiro
  * @param	table		Tabela hash de execues de operaes
+ * @param	duplicates	Apontador onde  guardada a quantidade de execues repetidas que foram ignoradas (ou NULL)
  * @return	A tabela hash de execues de operaes do ficheiro .csv
 */
-ExecutionNode** readExecutions_AtTable_Text(char fileName[], ExecutionNode* table[])
+ExecutionNode** readExecutions_AtTable_Text(char fileName[], ExecutionNode* table[], int* duplicates)
 {
-	// iniciar tabela hash vazia
-	*table = newExecutionsTable_Empty(table);
-
-	if (table == NULL || *table == NULL)
-	{
-		return NULL;
-	}
-
 	FILE* file = fopen(fileName, "r");
 	if (file == NULL)
 	{
@@ -1036,26 +1499,47 @@ ExecutionNode** readExecutions_AtTable_Text(char fileName[], ExecutionNode* tabl
 	int machineID = 0;
 	int runtime = 0;
 
-	Execution* execution = NULL;
+	// todas as linhas so lidas para um array e a tabela  criada no fim, de uma s vez
+	int count = 0, capacity = 1024;
+	Execution* executions = (Execution*)malloc(capacity * sizeof(Execution));
 
-	while (fgets(line, FILE_LINE_SIZE, file) != NULL)
+	while (executions != NULL && fgets(line, FILE_LINE_SIZE, file) != NULL)
 	{
 		if (sscanf(line, "%d;%d;%d", &operationID, &machineID, &runtime) == 3) // ignora o cabealho do .csv
 		{
-			execution = newExecution(operationID, machineID, runtime);
-			if (execution == NULL)
+			if (count == capacity)
 			{
-				fclose(file);
-				return NULL;
+				capacity *= 2;
+				Execution* grown = (Execution*)realloc(executions, capacity * sizeof(Execution));
+				if (grown == NULL) // se no houver memria para alocar
+				{
+					free(executions);
+					executions = NULL;
+					break;
+				}
+				executions = grown;
 			}
 
-			*table = insertExecution_AtTable(table, execution);
+			executions[count].operationID = operationID;
+			executions[count].machineID = machineID;
+			executions[count].runtime = runtime;
+			executions[count].next = NULL;
+			count++;
 		}
 	}
 
 	fclose(file);
 
-	return *table;
+	if (executions == NULL)
+	{
+		return NULL;
+	}
+
+	ExecutionNode** built = newExecutionsTable_Bulk(table, executions, count, duplicates);
+
+	free(executions);
+
+	return built;
 }
 
 
@@ -1192,6 +1676,310 @@ Execution* searchExecution_AtTable(ExecutionNode* table[], int operationID, int
 }
 
 
+/**
+ * @brief	Obter os agregados dos tempos de execuo de uma operao (mnimo, mximo, soma e quantidade de mquinas alternativas)
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @return	Agregados da operao (ou NULL se a operao no tiver execues)
+*/
+OperationStatistics* getOperationStatistics_AtTable(ExecutionNode* table[], int operationID)
+{
+	if (table == NULL || *table == NULL)
+	{
+		return NULL;
+	}
+
+	OperationStatistics* current = table[getStatisticsIndex(operationID)]->statistics;
+
+	while (current != NULL && current->operationID != operationID)
+	{
+		current = current->next;
+	}
+
+	return current;
+}
+
+
+/**
+ * @brief	Obter os agregados de um trabalho
+ * @param	table	Tabela hash das execues de operaes
+ * @param	jobID	Identificador do trabalho
+ * @return	Agregados do trabalho (ou NULL se nenhuma operao do trabalho tiver execues)
+*/
+static JobStatistics* getJobStatistics(ExecutionNode* table[], int jobID)
+{
+	JobStatistics* current = table[getStatisticsIndex(jobID)]->jobs;
+
+	while (current != NULL && current->jobID != jobID)
+	{
+		current = current->next;
+	}
+
+	return current;
+}
+
+
+/**
+ * @brief	Libertar os agregados dos trabalhos de uma tabela, desassociando deles os agregados das operaes
+ * @param	table	Tabela hash das execues de operaes
+*/
+static void cleanJobStatistics(ExecutionNode* table[])
+{
+	for (int i = 0; i < HASH_TABLE_SIZE && table[i] != NULL; i++)
+	{
+		while (table[i]->jobs != NULL)
+		{
+			JobStatistics* job = table[i]->jobs;
+			table[i]->jobs = job->next;
+			free(job->operations);
+			free(job);
+		}
+
+		for (OperationStatistics* current = table[i]->statistics; current != NULL; current = current->next)
+		{
+			current->job = NULL;
+		}
+	}
+
+	if (table[0] == jobsTable)
+	{
+		jobsTable = NULL;
+	}
+}
+
+
+/**
+ * @brief	Associar os agregados das operaes aos agregados dos respetivos trabalhos, se as operaes mudaram desde a ltima associao
+ *
+ * A lista de operaes s  percorrida quando muda (ver operationsVersion) ou quando uma operao ganha ou perde todas as execues.
+ * Entre essas mudanas, os totais de cada trabalho so atualizados em tempo constante por cada execuo inserida, atualizada ou removida.
+ * @param	table		Tabela hash das execues de operaes
+ * @param	operations	Lista de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool bindJobs_AtTable(ExecutionNode* table[], Operation* operations)
+{
+	if (jobsTable == table[0] && jobsOperations == operations && jobsVersion == operationsVersion)
+	{
+		return true;
+	}
+
+	cleanJobStatistics(table);
+
+	// contar as operaes com execues de cada trabalho
+	for (Operation* current = operations; current != NULL; current = current->next)
+	{
+		OperationStatistics* statistics = getOperationStatistics_AtTable(table, current->operationID);
+		if (statistics == NULL || statistics->job != NULL) // sem execues (ou repetida na lista)
+		{
+			continue;
+		}
+
+		JobStatistics* job = getJobStatistics(table, current->jobID);
+		if (job == NULL)
+		{
+			job = (JobStatistics*)calloc(1, sizeof(JobStatistics));
+			if (job == NULL) // se no houver memria para alocar
+			{
+				cleanJobStatistics(table);
+				return false;
+			}
+
+			job->jobID = current->jobID;
+			job->next = table[getStatisticsIndex(current->jobID)]->jobs;
+			table[getStatisticsIndex(current->jobID)]->jobs = job;
+		}
+
+		statistics->job = job;
+		statistics->position = current->position;
+		job->numberOfOperations++;
+	}
+
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		for (JobStatistics* job = table[i]->jobs; job != NULL; job = job->next)
+		{
+			job->operations = (OperationStatistics**)malloc(job->numberOfOperations * sizeof(OperationStatistics*));
+			if (job->operations == NULL)
+			{
+				cleanJobStatistics(table);
+				return false;
+			}
+
+			job->numberOfOperations = 0;
+		}
+	}
+
+	// guardar as operaes de cada trabalho pela posio e somar os seus extremos
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		for (OperationStatistics* statistics = table[i]->statistics; statistics != NULL; statistics = statistics->next)
+		{
+			JobStatistics* job = statistics->job;
+			if (job == NULL)
+			{
+				continue;
+			}
+
+			int k = job->numberOfOperations++;
+			while (k > 0 && job->operations[k - 1]->position > statistics->position)
+			{
+				job->operations[k] = job->operations[k - 1];
+				k--;
+			}
+
+			job->operations[k] = statistics;
+			job->minTotal += statistics->min;
+			job->maxTotal += statistics->max;
+		}
+	}
+
+	jobsTable = table[0];
+	jobsOperations = operations;
+	jobsVersion = operationsVersion;
+
+	return true;
+}
+
+
+/**
+ * @brief	Obter o mnimo de tempo necessrio para completar um trabalho e as respetivas execues, a partir dos agregados da tabela hash
+ *
+ * O total  mantido nos agregados do trabalho, por isso s as execues devolvidas percorrem as operaes (apenas as do trabalho).
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operations		Lista de operaes
+ * @param	jobID			Identificador do trabalho
+ * @param	minExecutions	Apontador para a lista de execues de operaes a ser devolvida, relativamente ao tempo mnimo (ou NULL)
+ * @return	Quantidade de tempo (ou -1 se no existirem dados)
+*/
+int getMinTime_ToCompleteJob_AtTable(ExecutionNode* table[], Operation* operations, int jobID, Execution** minExecutions)
+{
+	if (table == NULL || *table == NULL || operations == NULL || !bindJobs_AtTable(table, operations))
+	{
+		return -1;
+	}
+
+	JobStatistics* job = getJobStatistics(table, jobID);
+	if (job == NULL)
+	{
+		return 0;
+	}
+
+	for (int i = job->numberOfOperations - 1; i >= 0 && minExecutions != NULL; i--)
+	{
+		OperationStatistics* statistics = job->operations[i];
+		*minExecutions = insertExecution_AtStart_AtList(*minExecutions, newExecution(statistics->operationID, statistics->minMachineID, statistics->min));
+	}
+
+	return job->minTotal;
+}
+
+
+/**
+ * @brief	Obter o mximo de tempo necessrio para completar um trabalho e as respetivas execues, a partir dos agregados da tabela hash
+ *
+ * O total  mantido nos agregados do trabalho, por isso s as execues devolvidas percorrem as operaes (apenas as do trabalho).
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operations		Lista de operaes
+ * @param	jobID			Identificador do trabalho
+ * @param	maxExecutions	Apontador para a lista de execues de operaes a ser devolvida, relativamente ao tempo mximo (ou NULL)
+ * @return	Quantidade de tempo (ou -1 se no existirem dados)
+*/
+int getMaxTime_ToCompleteJob_AtTable(ExecutionNode* table[], Operation* operations, int jobID, Execution** maxExecutions)
+{
+	if (table == NULL || *table == NULL || operations == NULL || !bindJobs_AtTable(table, operations))
+	{
+		return -1;
+	}
+
+	JobStatistics* job = getJobStatistics(table, jobID);
+	if (job == NULL)
+	{
+		return 0;
+	}
+
+	for (int i = job->numberOfOperations - 1; i >= 0 && maxExecutions != NULL; i--)
+	{
+		OperationStatistics* statistics = job->operations[i];
+		*maxExecutions = insertExecution_AtStart_AtList(*maxExecutions, newExecution(statistics->operationID, statistics->maxMachineID, statistics->max));
+	}
+
+	return job->maxTotal;
+}
+
+
+/**
+ * @brief	Obter a mdia de tempo necessrio para completar uma operao, considerando todas as alternativas possveis, a partir dos agregados da tabela hash
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @return	Valor da mdia de tempo (ou -1 se no existirem dados)
+*/
+float getAverageTime_ToCompleteOperation_AtTable(ExecutionNode* table[], int operationID)
+{
+	if (table == NULL || *table == NULL)
+	{
+		return -1.0f;
+	}
+
+	OperationStatistics* statistics = getOperationStatistics_AtTable(table, operationID);
+
+	if (statistics == NULL || statistics->count == 0) // para no permitir diviso por 0
+	{
+		return 0.0f;
+	}
+
+	return (float)statistics->sum / statistics->count;
+}
+
+
+/**
+ * @brief	Obter o trabalho mnimo que falta ao trabalho de uma operao depois dela (soma dos menores tempos de execuo das operaes seguintes)
+ *
+ * S so percorridas as operaes seguintes do mesmo trabalho, a partir dos agregados do trabalho.
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operations		Lista de operaes
+ * @param	operationID		Identificador da operao
+ * @return	Quantidade de tempo (ou -1 se a operao no existir)
+*/
+int getRemainingWork_AtTable(ExecutionNode* table[], Operation* operations, int operationID)
+{
+	if (table == NULL || *table == NULL || !bindJobs_AtTable(table, operations))
+	{
+		return -1;
+	}
+
+	OperationStatistics* statistics = getOperationStatistics_AtTable(table, operationID);
+	JobStatistics* job;
+	int position;
+
+	if (statistics != NULL && statistics->job != NULL)
+	{
+		job = statistics->job;
+		position = statistics->position;
+	}
+	else // a operao no tem execues, por isso o trabalho e a posio vm da lista
+	{
+		Operation* operation = getOperation(operations, operationID);
+		if (operation == NULL)
+		{
+			return -1;
+		}
+
+		job = getJobStatistics(table, operation->jobID);
+		position = operation->position;
+	}
+
+	int remaining = 0;
+
+	for (int i = job != NULL ? job->numberOfOperations - 1 : -1; i >= 0 && job->operations[i]->position > position; i--)
+	{
+		remaining += job->operations[i]->min;
+	}
+
+	return remaining;
+}
+
+
 /**
  * @brief	Limpar a tabela hash de execues de operaes da memria
  * @param	table	Lista de execues de operaes
@@ -1246,6 +2034,11 @@ bool cleanExecutions_Table(ExecutionNode** table[])
 	ExecutionNode* currentNode;
 	Execution* currentExecution;
 
+	if (table[0] != NULL)
+	{
+		cleanJobStatistics((ExecutionNode**)table);
+	}
+
 	for (int i = 0; i < HASH_TABLE_SIZE; i++)
 	{
 		currentNode = table[i];
@@ -1260,6 +2053,15 @@ bool cleanExecutions_Table(ExecutionNode** table[])
 			currentExecution = currentNode->start;
 			cleanExecutions_List(&currentExecution);
 
+			while (currentNode->statistics != NULL)
+			{
+				OperationStatistics* statistics = currentNode->statistics;
+				currentNode->statistics = statistics->next;
+				free(statistics->machineIDs);
+				free(statistics->runtimes);
+				free(statistics);
+			}
+
 			/*		while (currentExecution != NULL)
 			{
 						ExecutionNode* tempExecution = currentExecution;
@@ -1281,6 +2083,8 @@ bool cleanExecutions_Table(ExecutionNode** table[])
 		table[i] = NULL;
 	}
 
+	dirtyData.executions = true;
+
 	return true;
 }
 
@@ -0,0 +1,227 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas aos conjuntos de impresses digitais de planos (memria tabu e deteo de repetidos).
+ * @file	fingerprints.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+
+
+/**
+ * @brief	Obter a posio inicial de uma impresso digital na tabela (os bits mais altos j esto bem misturados pelas chaves de Zobrist)
+*/
+static int getSlot(FingerprintSet* set, unsigned long long fingerprint)
+{
+	return (int)((fingerprint ^ (fingerprint >> 32)) & (unsigned long long)(set->tableSize - 1));
+}
+
+
+/**
+ * @brief	Remover uma impresso digital da tabela (deslocando para trs as seguintes da mesma sequncia de sondagem)
+ * @param	set			Conjunto
+ * @param	fingerprint	Impresso digital (diferente de 0)
+*/
+static void removeFingerprint_AtTable(FingerprintSet* set, unsigned long long fingerprint)
+{
+	int mask = set->tableSize - 1;
+	int slot = getSlot(set, fingerprint);
+
+	while (set->table[slot] != fingerprint)
+	{
+		if (set->table[slot] == 0)
+		{
+			return;
+		}
+
+		slot = (slot + 1) & mask;
+	}
+
+	int next = (slot + 1) & mask;
+
+	while (set->table[next] != 0)
+	{
+		int home = getSlot(set, set->table[next]);
+
+		// a entrada pode ocupar o lugar libertado se este estiver entre a sua posio inicial e a atual
+		if (((next - home) & mask) >= ((next - slot) & mask))
+		{
+			set->table[slot] = set->table[next];
+			slot = next;
+		}
+
+		next = (next + 1) & mask;
+	}
+
+	set->table[slot] = 0;
+}
+
+
+/**
+ * @brief	Criar um conjunto vazio de impresses digitais
+ * @param	memory	Quantidade mxima de impresses digitais guardadas (as mais antigas so esquecidas)
+ * @return	Conjunto criado (ou NULL se no houver memria)
+*/
+FingerprintSet* newFingerprintSet(int memory)
+{
+	if (memory <= 0)
+	{
+		return NULL;
+	}
+
+	FingerprintSet* new = (FingerprintSet*)calloc(1, sizeof(FingerprintSet));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	new->tableSize = 2;
+	while (new->tableSize < 2 * memory)
+	{
+		new->tableSize *= 2;
+	}
+
+	new->memory = memory;
+	new->table = (unsigned long long*)calloc(new->tableSize, sizeof(unsigned long long));
+	new->recent = (unsigned long long*)malloc(memory * sizeof(unsigned long long));
+
+	if (new->table == NULL || new->recent == NULL)
+	{
+		cleanFingerprintSet(&new);
+		return NULL;
+	}
+
+	return new;
+}
+
+
+/**
+ * @brief	Inserir uma impresso digital no conjunto, esquecendo a mais antiga se a memria estiver cheia
+ * @param	set			Conjunto
+ * @param	fingerprint	Impresso digital
+ * @return	Booleano para o resultado da funo (true se  nova, false se j estava no conjunto)
+*/
+bool insertFingerprint_AtSet(FingerprintSet* set, unsigned long long fingerprint)
+{
+	if (set == NULL)
+	{
+		return false;
+	}
+
+	fingerprint = fingerprint == 0 ? 1 : fingerprint; // 0 indica um lugar vazio
+
+	int mask = set->tableSize - 1;
+	int slot = getSlot(set, fingerprint);
+
+	while (set->table[slot] != 0)
+	{
+		if (set->table[slot] == fingerprint)
+		{
+			return false;
+		}
+
+		slot = (slot + 1) & mask;
+	}
+
+	if (set->count == set->memory)
+	{
+		removeFingerprint_AtTable(set, set->recent[set->oldest]);
+		set->recent[set->oldest] = fingerprint;
+		set->oldest = (set->oldest + 1) % set->memory;
+
+		// a remoo pode ter deslocado entradas, pelo que o lugar livre  procurado de novo
+		slot = getSlot(set, fingerprint);
+		while (set->table[slot] != 0)
+		{
+			slot = (slot + 1) & mask;
+		}
+	}
+	else
+	{
+		set->recent[(set->oldest + set->count) % set->memory] = fingerprint;
+		set->count++;
+	}
+
+	set->table[slot] = fingerprint;
+
+	return true;
+}
+
+
+/**
+ * @brief	Verificar se uma impresso digital est no conjunto
+ * @param	set			Conjunto
+ * @param	fingerprint	Impresso digital
+ * @return	Booleano para o resultado da funo (se est ou no)
+*/
+bool containsFingerprint_AtSet(FingerprintSet* set, unsigned long long fingerprint)
+{
+	if (set == NULL)
+	{
+		return false;
+	}
+
+	fingerprint = fingerprint == 0 ? 1 : fingerprint;
+
+	int mask = set->tableSize - 1;
+
+	for (int slot = getSlot(set, fingerprint); set->table[slot] != 0; slot = (slot + 1) & mask)
+	{
+		if (set->table[slot] == fingerprint)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/**
+ * @brief	Esvaziar o conjunto
+ * @param	set		Conjunto
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool clearFingerprintSet(FingerprintSet* set)
+{
+	if (set == NULL)
+	{
+		return false;
+	}
+
+	// apenas os lugares ocupados so limpos
+	for (int i = 0; i < set->count; i++)
+	{
+		removeFingerprint_AtTable(set, set->recent[(set->oldest + i) % set->memory]);
+	}
+
+	set->count = 0;
+	set->oldest = 0;
+
+	return true;
+}
+
+
+/**
+ * @brief	Libertar a memria do conjunto
+ * @param	set		Apontador para o conjunto
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanFingerprintSet(FingerprintSet** set)
+{
+	if (set == NULL || *set == NULL)
+	{
+		return false;
+	}
+
+	free((*set)->table);
+	free((*set)->recent);
+	free(*set);
+	*set = NULL;
+
+	return true;
+}
\ No newline at end of file
@@ -13,18 +13,24 @@
 
 ExecutionNode* newExecutionNode();
 ExecutionNode** newExecutionsTable_Empty(ExecutionNode* table[]);
+ExecutionNode** newExecutionsTable_Bulk(ExecutionNode* table[], Execution* executions, int count, int* duplicates);
 int generateHash(int machineID);
 ExecutionNode** insertExecution_AtTable(ExecutionNode* table[], Execution* new);
 bool updateRuntime_ByOperation_AtTable(ExecutionNode** table[], int operationID, int machineID, int runtime);
 bool deleteExecutions_ByOperation_AtTable(ExecutionNode** table[], int operationID);
 bool deleteExecutions_ByMachine_AtTable(ExecutionNode** table[], int machineID);
 ExecutionNode** readExecutions_AtTable_Example(ExecutionNode* table[]);
-ExecutionNode** readExecutions_AtTable_Binary(char fileName[], ExecutionNode* table[]);
-ExecutionNode** readExecutions_AtTable_Text(char fileName[], ExecutionNode* table[]);
+ExecutionNode** readExecutions_AtTable_Binary(char fileName[], ExecutionNode* table[], int* duplicates);
+ExecutionNode** readExecutions_AtTable_Text(char fileName[], ExecutionNode* table[], int* duplicates);
 bool writeExecutions_AtTable_Binary(char fileName[], ExecutionNode* table[]);
 bool writeExecutions_AtTable_Text(char fileName[], ExecutionNode* table[]);
 bool displayExecutions_AtTable(ExecutionNode* table[]);
 Execution* searchExecution_AtTable(ExecutionNode* table[], int operationID, int machineID);
+OperationStatistics* getOperationStatistics_AtTable(ExecutionNode* table[], int operationID);
+int getMinTime_ToCompleteJob_AtTable(ExecutionNode* table[], Operation* operations, int jobID, Execution** minExecutions);
+int getMaxTime_ToCompleteJob_AtTable(ExecutionNode* table[], Operation* operations, int jobID, Execution** maxExecutions);
+float getAverageTime_ToCompleteOperation_AtTable(ExecutionNode* table[], int operationID);
+int getRemainingWork_AtTable(ExecutionNode* table[], Operation* operations, int operationID);
 bool cleanExecutions_Table(ExecutionNode** table[]);
 
 #pragma endregion
@@ -0,0 +1,855 @@
+/**
+ * @brief	Ficheiro com todas as funes para carregar a instncia compacta diretamente dos ficheiros, sem passar pelas listas.
+ * @file	instance-files.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "data-types.h"
+#include "hashing.h"
+#include "scheduling.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Parte do ficheiro .csv das execues lida por uma thread
+*/
+typedef struct ParseChunk
+{
+	const char* start; // incio da parte (sempre no incio de uma linha)
+	const char* end;
+	int* values; // execues lidas da parte, com 3 valores cada
+	int rows;
+	int bucketCount[HASH_TABLE_SIZE]; // execues da parte em cada posio da tabela hash (depois da juno, prxima posio livre no array final)
+	int* ordered; // array final, partilhado (cada parte escreve em posies diferentes)
+	bool succeeded;
+} ParseChunk;
+
+
+#pragma region ficheiros de texto
+
+/**
+ * @brief	Ler um inteiro (com sinal opcional e espaos antes) de uma linha
+ * @param	cursor	Incio do texto
+ * @param	end		Fim da linha
+ * @param	value	Apontador onde  guardado o inteiro
+ * @return	Posio a seguir ao inteiro (ou NULL se no comear por um inteiro)
+*/
+static const char* parseInteger(const char* cursor, const char* end, int* value)
+{
+	while (cursor < end && (*cursor == ' ' || *cursor == '\t'))
+	{
+		cursor++;
+	}
+
+	bool negative = cursor < end && *cursor == '-';
+	cursor += cursor < end && (*cursor == '-' || *cursor == '+');
+
+	if (cursor == end || *cursor < '0' || *cursor > '9')
+	{
+		return NULL;
+	}
+
+	int result = 0;
+	while (cursor < end && *cursor >= '0' && *cursor <= '9')
+	{
+		result = result * 10 + (*cursor++ - '0');
+	}
+
+	*value = negative ? -result : result;
+
+	return cursor;
+}
+
+
+/**
+ * @brief	Ler os inteiros separados por ';' do incio de uma linha de um ficheiro .csv
+ * @param	cursor	Incio da linha
+ * @param	end		Fim da linha
+ * @param	values	Array onde so guardados os inteiros
+ * @param	columns	Quantidade de inteiros a ler
+ * @param	named	Se depois dos inteiros a linha tem de ter um nome (separado por ';')
+ * @return	Booleano para o resultado da funo (false se a linha no tem o formato pedido, como o cabealho)
+*/
+static bool parseLine(const char* cursor, const char* end, int* values, int columns, bool named)
+{
+	for (int c = 0; c < columns; c++)
+	{
+		if (c > 0)
+		{
+			if (cursor == end || *cursor != ';')
+			{
+				return false;
+			}
+
+			cursor++;
+		}
+
+		cursor = parseInteger(cursor, end, &values[c]);
+		if (cursor == NULL)
+		{
+			return false;
+		}
+	}
+
+	// o nome tem de ter pelo menos um carcter
+	return !named || (end - cursor >= 2 && cursor[0] == ';' && cursor[1] != '\r');
+}
+
+
+/**
+ * @brief	Contar as linhas de um texto (um limite superior, porque a ltima linha pode estar vazia)
+ * @param	start	Incio do texto
+ * @param	end		Fim do texto
+ * @return	Quantidade de linhas
+*/
+static long long countLines(const char* start, const char* end)
+{
+	long long lines = 1;
+
+	for (const char* cursor = start; cursor < end; lines++)
+	{
+		cursor = (const char*)memchr(cursor, '\n', end - cursor);
+		if (cursor == NULL)
+		{
+			break;
+		}
+
+		cursor++;
+	}
+
+	return lines;
+}
+
+
+/**
+ * @brief	Ler os inteiros do incio de cada linha de um texto para um array
+ * @param	start	Incio do texto
+ * @param	end		Fim do texto
+ * @param	values	Array onde so guardados os inteiros de cada linha seguidos (com espao para todas as linhas)
+ * @param	columns	Quantidade de inteiros no incio de cada linha
+ * @param	named	Se cada linha termina com um nome
+ * @return	Quantidade de linhas lidas (as que no tm o formato pedido, como o cabealho, so ignoradas)
+*/
+static int parseLines(const char* start, const char* end, int* values, int columns, bool named)
+{
+	int rows = 0;
+
+	for (const char* cursor = start; cursor < end;)
+	{
+		const char* lineEnd = (const char*)memchr(cursor, '\n', end - cursor);
+		lineEnd = lineEnd == NULL ? end : lineEnd;
+
+		if (parseLine(cursor, lineEnd, values + (long long)rows * columns, columns, named))
+		{
+			rows++;
+		}
+
+		cursor = lineEnd + 1;
+	}
+
+	return rows;
+}
+
+
+/**
+ * @brief	Carregar as colunas inteiras de um ficheiro .csv mapeado em memria para um array
+ *
+ * Uma 1 passagem conta as linhas para dimensionar o array e uma 2 l os inteiros, sem alocar memria por registo.
+ * @param	fileName	Nome do ficheiro
+ * @param	columns		Quantidade de inteiros no incio de cada linha
+ * @param	named		Se cada linha termina com um nome
+ * @param	rows		Apontador onde  guardada a quantidade de linhas lidas
+ * @return	Array com os inteiros de cada linha seguidos (ou NULL se no for possvel ler o ficheiro)
+*/
+static int* readColumns_Text(char fileName[], int columns, bool named, int* rows)
+{
+	MappedFile file;
+	if (!mapFile(fileName, &file))
+	{
+		return NULL;
+	}
+
+	const char* end = file.data + file.size;
+
+	int* values = (int*)malloc((countLines(file.data, end) * columns + 1) * sizeof(int));
+	if (values == NULL) // se no houver memria para alocar
+	{
+		unmapFile(&file);
+		return NULL;
+	}
+
+	*rows = parseLines(file.data, end, values, columns, named);
+
+	unmapFile(&file);
+
+	return values;
+}
+
+
+/**
+ * @brief	Ler as execues de uma parte do ficheiro .csv e cont-las por posio da tabela hash (executada numa thread)
+ * @param	argument	Parte do ficheiro
+*/
+static void parseExecutions_Chunk(void* argument)
+{
+	ParseChunk* chunk = (ParseChunk*)argument;
+
+	chunk->values = (int*)malloc((countLines(chunk->start, chunk->end) * 3 + 1) * sizeof(int));
+	if (chunk->values == NULL) // se no houver memria para alocar
+	{
+		chunk->succeeded = false;
+		return;
+	}
+
+	chunk->rows = parseLines(chunk->start, chunk->end, chunk->values, 3, false);
+
+	for (int i = 0; i < chunk->rows; i++)
+	{
+		int bucket = generateHash(chunk->values[3 * i + 1]);
+		chunk->bucketCount[bucket < 0 ? 0 : bucket]++;
+	}
+
+	chunk->succeeded = true;
+}
+
+
+/**
+ * @brief	Copiar as execues de uma parte para as suas posies no array final (executada numa thread)
+ * @param	argument	Parte do ficheiro
+*/
+static void scatterExecutions_Chunk(void* argument)
+{
+	ParseChunk* chunk = (ParseChunk*)argument;
+
+	// da ltima para a primeira, tal como ao inserir na tabela hash
+	for (int i = chunk->rows - 1; i >= 0; i--)
+	{
+		int bucket = generateHash(chunk->values[3 * i + 1]);
+		long long k = chunk->bucketCount[bucket < 0 ? 0 : bucket]++;
+
+		chunk->ordered[3 * k] = chunk->values[3 * i];
+		chunk->ordered[3 * k + 1] = chunk->values[3 * i + 1];
+		chunk->ordered[3 * k + 2] = chunk->values[3 * i + 2];
+	}
+}
+
+
+/**
+ * @brief	Executar uma funo sobre todas as partes do ficheiro, uma thread por parte
+ *
+ * A 1 parte  executada na thread atual, tal como as partes cuja thread no foi possvel criar.
+ * @param	chunks				Partes do ficheiro
+ * @param	numberOfChunks		Quantidade de partes
+ * @param	function			Funo executada sobre cada parte
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool runChunks(ParseChunk* chunks, int numberOfChunks, ThreadFunction function)
+{
+	Thread* threads = (Thread*)malloc(numberOfChunks * sizeof(Thread));
+	bool* started = (bool*)calloc(numberOfChunks, sizeof(bool));
+
+	if (threads == NULL || started == NULL)
+	{
+		free(threads);
+		free(started);
+		return false;
+	}
+
+	for (int t = 1; t < numberOfChunks; t++)
+	{
+		started[t] = startThread(&threads[t], function, &chunks[t]);
+	}
+
+	for (int t = 0; t < numberOfChunks; t++)
+	{
+		if (!started[t])
+		{
+			function(&chunks[t]);
+		}
+	}
+
+	for (int t = 1; t < numberOfChunks; t++)
+	{
+		if (started[t])
+		{
+			joinThread(threads[t]);
+		}
+	}
+
+	free(threads);
+	free(started);
+
+	return true;
+}
+
+
+/**
+ * @brief	Carregar as execues de um ficheiro .csv mapeado em memria, lendo partes do ficheiro em paralelo
+ *
+ * O ficheiro  dividido em partes com pelo menos PARSE_CHUNK_MIN_SIZE bytes (uma por processador), que comeam sempre
+ * no incio de uma linha. Cada thread l a sua parte para um array prprio e conta as execues por posio da tabela hash;
+ * uma soma de prefixos dessas contagens d a posio de cada execuo no array final, para onde as threads as copiam.
+ * As execues ficam pela ordem que teriam na tabela hash: por posio na tabela e, em cada posio, da ltima para a primeira do ficheiro
+ * (a ltima no array prevalece nas repetidas, ou seja, a primeira do ficheiro, tal como ao inserir na tabela).
+ * @param	fileName	Nome do ficheiro
+ * @param	rows		Apontador onde  guardada a quantidade de execues lidas
+ * @return	Array com as execues, com 3 valores cada (ou NULL se no for possvel ler o ficheiro)
+*/
+static int* readExecutions_Parallel(char fileName[], int* rows)
+{
+	MappedFile file;
+	if (!mapFile(fileName, &file))
+	{
+		return NULL;
+	}
+
+	const char* end = file.data + file.size;
+	int numberOfChunks = (int)(file.size / PARSE_CHUNK_MIN_SIZE) + 1;
+	int numberOfProcessors = getNumberOfProcessors();
+
+	numberOfChunks = numberOfChunks < numberOfProcessors ? numberOfChunks : numberOfProcessors;
+	numberOfChunks = numberOfChunks > 0 ? numberOfChunks : 1;
+
+	ParseChunk* chunks = (ParseChunk*)calloc(numberOfChunks, sizeof(ParseChunk));
+	if (chunks == NULL) // se no houver memria para alocar
+	{
+		unmapFile(&file);
+		return NULL;
+	}
+
+	// cada parte comea depois da mudana de linha seguinte  diviso em partes iguais
+	chunks[0].start = file.data;
+
+	for (int t = 1; t < numberOfChunks; t++)
+	{
+		const char* start = file.data + file.size * t / numberOfChunks;
+
+		if (start > chunks[t - 1].start)
+		{
+			const char* newline = (const char*)memchr(start - 1, '\n', end - start + 1);
+			start = newline != NULL ? newline + 1 : end;
+		}
+		else // a parte anterior j passou deste ponto
+		{
+			start = chunks[t - 1].start;
+		}
+
+		chunks[t].start = start;
+		chunks[t - 1].end = start;
+	}
+
+	chunks[numberOfChunks - 1].end = end;
+
+	bool succeeded = runChunks(chunks, numberOfChunks, parseExecutions_Chunk);
+
+	for (int t = 0; t < numberOfChunks; t++)
+	{
+		succeeded = succeeded && chunks[t].succeeded;
+	}
+
+	long long total = 0;
+
+	for (int t = 0; t < numberOfChunks; t++)
+	{
+		total += chunks[t].rows;
+	}
+
+	int* ordered = succeeded ? (int*)malloc((3 * total + 1) * sizeof(int)) : NULL;
+
+	if (ordered != NULL)
+	{
+		// em cada posio da tabela, as partes ficam da ltima para a primeira
+		long long next = 0;
+
+		for (int b = 0; b < HASH_TABLE_SIZE; b++)
+		{
+			for (int t = numberOfChunks - 1; t >= 0; t--)
+			{
+				int count = chunks[t].bucketCount[b];
+				chunks[t].bucketCount[b] = (int)next;
+				next += count;
+			}
+		}
+
+		for (int t = 0; t < numberOfChunks; t++)
+		{
+			chunks[t].ordered = ordered;
+		}
+
+		if (runChunks(chunks, numberOfChunks, scatterExecutions_Chunk))
+		{
+			*rows = (int)total;
+		}
+		else
+		{
+			free(ordered);
+			ordered = NULL;
+		}
+	}
+
+	for (int t = 0; t < numberOfChunks; t++)
+	{
+		free(chunks[t].values);
+	}
+
+	free(chunks);
+	unmapFile(&file);
+
+	return ordered;
+}
+
+
+/**
+ * @brief	Carregar uma instncia compacta diretamente dos ficheiros .csv, mapeados em memria
+ *
+ * Produz a mesma instncia que carregar as listas e a tabela hash e chamar newInstance, mas sem alocar memria por registo.
+ * @param	jobsFileName		Nome do ficheiro dos trabalhos
+ * @param	machinesFileName	Nome do ficheiro das mquinas
+ * @param	operationsFileName	Nome do ficheiro das operaes
+ * @param	executionsFileName	Nome do ficheiro das execues de operaes
+ * @return	Nova instncia (ou NULL se no for possvel ler os ficheiros ou os dados no permitem escalonar)
+*/
+Instance* readInstance_Text(char jobsFileName[], char machinesFileName[], char operationsFileName[], char executionsFileName[])
+{
+	int numberOfJobs = 0, numberOfMachines = 0, numberOfOperations = 0, numberOfExecutions = 0;
+
+	int* jobIDs = readColumns_Text(jobsFileName, 1, true, &numberOfJobs);
+	int* machineIDs = readColumns_Text(machinesFileName, 1, true, &numberOfMachines);
+	int* operations = readColumns_Text(operationsFileName, 3, true, &numberOfOperations);
+	int* executions = readExecutions_Parallel(executionsFileName, &numberOfExecutions); // j pela ordem da tabela hash
+
+	if (jobIDs == NULL || machineIDs == NULL || operations == NULL || executions == NULL)
+	{
+		free(jobIDs);
+		free(machineIDs);
+		free(operations);
+		free(executions);
+		return NULL;
+	}
+
+	Instance* new = newInstance_Arrays(jobIDs, numberOfJobs, machineIDs, numberOfMachines, operations, numberOfOperations, executions, numberOfExecutions);
+
+	free(jobIDs);
+	free(machineIDs);
+	free(operations);
+	free(executions);
+
+	return new;
+}
+
+#pragma endregion
+
+
+#pragma region ficheiros de benchmark (.fjs)
+
+/**
+ * @brief	Ler o prximo inteiro de um ficheiro .fjs, ignorando os espaos e as mudanas de linha antes
+ * @param	cursor	Apontador para a posio atual no texto (avana para depois do inteiro)
+ * @param	end		Fim do texto
+ * @param	value	Apontador onde  guardado o inteiro
+ * @return	Booleano para o resultado da funo (se foi lido um inteiro ou no)
+*/
+static bool nextInteger(const char** cursor, const char* end, int* value)
+{
+	while (*cursor < end && (**cursor == ' ' || **cursor == '\t' || **cursor == '\r' || **cursor == '\n'))
+	{
+		(*cursor)++;
+	}
+
+	const char* next = parseInteger(*cursor, end, value);
+	if (next == NULL)
+	{
+		return false;
+	}
+
+	*cursor = next;
+
+	return true;
+}
+
+
+/**
+ * @brief	Carregar uma instncia compacta de um ficheiro no formato .fjs dos benchmarks da literatura (Brandimarte, Hurink, Dauzre-Prs e Paulli, Fattahi)
+ *
+ * A 1 linha tem a quantidade de trabalhos, a quantidade de mquinas e (opcionalmente) a mdia de mquinas por operao.
+ * Cada trabalho tem a quantidade de operaes e, para cada operao, a quantidade de mquinas seguida de pares mquina e tempo de execuo.
+ * O ficheiro  lido de uma s vez, diretamente para os arrays da instncia. Os trabalhos, as mquinas e as operaes
+ * ficam com identificadores a partir de 1, pela ordem do ficheiro.
+ * @param	fileName	Nome do ficheiro
+ * @return	Nova instncia (ou NULL se no for possvel ler o ficheiro ou no estiver no formato esperado)
+*/
+Instance* readInstance_Benchmark(char fileName[])
+{
+	MappedFile file;
+	if (!mapFile(fileName, &file))
+	{
+		return NULL;
+	}
+
+	const char* cursor = file.data;
+	const char* end = file.data + file.size;
+	int numberOfJobs = 0, numberOfMachines = 0;
+
+	if (!nextInteger(&cursor, end, &numberOfJobs) || !nextInteger(&cursor, end, &numberOfMachines) || numberOfJobs <= 0 || numberOfMachines <= 0)
+	{
+		unmapFile(&file);
+		return NULL;
+	}
+
+	// ignorar o resto da 1 linha (a mdia de mquinas por operao no  um inteiro)
+	const char* lineEnd = (const char*)memchr(cursor, '\n', end - cursor);
+	cursor = lineEnd == NULL ? end : lineEnd;
+
+	Instance* new = (Instance*)calloc(1, sizeof(Instance));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		unmapFile(&file);
+		return NULL;
+	}
+
+	// cada operao ocupa pelo menos 3 inteiros e cada execuo 2, o que limita o tamanho dos arrays pelo tamanho do ficheiro
+	int maxOperations = (int)(file.size / 6 + 1), maxExecutions = (int)(file.size / 4 + 1);
+
+	new->numberOfJobs = numberOfJobs;
+	new->numberOfMachines = numberOfMachines;
+	new->jobIDs = (int*)malloc(numberOfJobs * sizeof(int));
+	new->machineIDs = (int*)malloc(numberOfMachines * sizeof(int));
+	new->jobStart = (int*)calloc(numberOfJobs + 1, sizeof(int));
+	new->operationIDs = (int*)malloc(maxOperations * sizeof(int));
+	new->operationJob = (int*)malloc(maxOperations * sizeof(int));
+	new->eligibleStart = (int*)calloc(maxOperations + 1, sizeof(int));
+	new->eligibleMachines = (int*)malloc(maxExecutions * sizeof(int));
+	new->eligibleRuntimes = (int*)malloc(maxExecutions * sizeof(int));
+
+	if (new->jobIDs == NULL || new->machineIDs == NULL || new->jobStart == NULL || new->operationIDs == NULL || new->operationJob == NULL
+		|| new->eligibleStart == NULL || new->eligibleMachines == NULL || new->eligibleRuntimes == NULL)
+	{
+		cleanInstance(&new);
+		unmapFile(&file);
+		return NULL;
+	}
+
+	for (int m = 0; m < numberOfMachines; m++)
+	{
+		new->machineIDs[m] = m + 1;
+	}
+
+	int o = 0, k = 0;
+	bool valid = true;
+
+	for (int j = 0; j < numberOfJobs && valid; j++)
+	{
+		int numberOfOperations = 0;
+		valid = nextInteger(&cursor, end, &numberOfOperations) && numberOfOperations > 0 && o + numberOfOperations <= maxOperations;
+
+		for (int i = 0; i < numberOfOperations && valid; i++, o++)
+		{
+			int numberOfEligible = 0;
+			valid = nextInteger(&cursor, end, &numberOfEligible) && numberOfEligible > 0 && k + numberOfEligible <= maxExecutions;
+
+			for (int e = 0; e < numberOfEligible && valid; e++, k++)
+			{
+				int machineID = 0;
+				valid = nextInteger(&cursor, end, &machineID) && nextInteger(&cursor, end, &new->eligibleRuntimes[k])
+					&& machineID >= 1 && machineID <= numberOfMachines && new->eligibleRuntimes[k] >= 0;
+
+				new->eligibleMachines[k] = machineID - 1;
+			}
+
+			new->operationIDs[o] = o + 1;
+			new->operationJob[o] = j;
+			new->eligibleStart[o + 1] = k;
+		}
+
+		new->jobIDs[j] = j + 1;
+		new->jobStart[j + 1] = o;
+	}
+
+	unmapFile(&file);
+
+	if (!valid)
+	{
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	new->numberOfOperations = o;
+	new->numberOfExecutions = k;
+	new->jobsCapacity = numberOfJobs;
+	new->operationsCapacity = maxOperations;
+	new->executionsCapacity = maxExecutions;
+
+	return new;
+}
+
+#pragma endregion
+
+
+#pragma region ficheiros binrios (snapshot)
+
+/**
+ * @brief	Calcular a soma de verificao de um bloco de memria (FNV-1a sobre palavras de 8 bytes, com mistura dos bits altos)
+ * @param	data	Incio do bloco
+ * @param	size	Tamanho do bloco em bytes
+ * @return	Soma de verificao
+*/
+static unsigned long long computeChecksum(const void* data, long long size)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	unsigned long long hash = 14695981039346656037ULL;
+	long long i = 0;
+
+	for (; i + 8 <= size; i += 8)
+	{
+		unsigned long long word;
+		memcpy(&word, bytes + i, sizeof(word));
+
+		hash = (hash ^ word) * 1099511628211ULL;
+		hash ^= hash >> 29;
+	}
+
+	for (; i < size; i++)
+	{
+		hash = (hash ^ bytes[i]) * 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+
+/**
+ * @brief	Arredondar uma posio do ficheiro para o prximo mltiplo de SNAPSHOT_ALIGNMENT
+ * @param	offset	Posio
+ * @return	Posio alinhada
+*/
+static long long alignOffset(long long offset)
+{
+	return (offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+
+/**
+ * @brief	Obter os arrays de uma instncia e os respetivos tamanhos, pela ordem em que so guardados no ficheiro binrio
+ * @param	instance	Instncia do problema
+ * @param	arrays		Array onde so guardados os apontadores para os arrays
+ * @param	counts		Array onde so guardadas as quantidades de inteiros de cada array
+*/
+static void getSnapshotArrays(Instance* instance, int** arrays[SNAPSHOT_SECTIONS], long long counts[SNAPSHOT_SECTIONS])
+{
+	arrays[0] = &instance->jobIDs;
+	arrays[1] = &instance->machineIDs;
+	arrays[2] = &instance->jobStart;
+	arrays[3] = &instance->operationIDs;
+	arrays[4] = &instance->operationJob;
+	arrays[5] = &instance->eligibleStart;
+	arrays[6] = &instance->eligibleMachines;
+	arrays[7] = &instance->eligibleRuntimes;
+
+	counts[0] = instance->numberOfJobs;
+	counts[1] = instance->numberOfMachines;
+	counts[2] = instance->numberOfJobs + 1;
+	counts[3] = instance->numberOfOperations;
+	counts[4] = instance->numberOfOperations;
+	counts[5] = instance->numberOfOperations + 1;
+	counts[6] = instance->numberOfExecutions;
+	counts[7] = instance->numberOfExecutions;
+}
+
+
+/**
+ * @brief	Verificar se os arrays de uma instncia lida de um ficheiro so coerentes (para no aceder fora dos arrays ao escalonar)
+ * @param	instance	Instncia do problema
+ * @return	Booleano para o resultado da funo (se  coerente ou no)
+*/
+static bool validateInstance(Instance* instance)
+{
+	if (instance->jobStart[0] != 0 || instance->jobStart[instance->numberOfJobs] != instance->numberOfOperations
+		|| instance->eligibleStart[0] != 0 || instance->eligibleStart[instance->numberOfOperations] != instance->numberOfExecutions)
+	{
+		return false;
+	}
+
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		if (instance->jobStart[j] > instance->jobStart[j + 1])
+		{
+			return false;
+		}
+
+		for (int o = instance->jobStart[j]; o < instance->jobStart[j + 1]; o++)
+		{
+			// cada operao tem de ter pelo menos uma mquina elegvel
+			if (instance->operationJob[o] != j || instance->eligibleStart[o] >= instance->eligibleStart[o + 1])
+			{
+				return false;
+			}
+		}
+	}
+
+	for (int k = 0; k < instance->numberOfExecutions; k++)
+	{
+		if (instance->eligibleMachines[k] < 0 || instance->eligibleMachines[k] >= instance->numberOfMachines || instance->eligibleRuntimes[k] < 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Guardar uma instncia compacta num nico ficheiro binrio (snapshot)
+ *
+ * O ficheiro tem um cabealho (SnapshotHeader) com a identificao do formato, a verso, a posio, o tamanho e a soma de verificao de cada array,
+ * seguido dos arrays da instncia, cada um alinhado a SNAPSHOT_ALIGNMENT bytes.
+ * @param	fileName	Nome do ficheiro
+ * @param	instance	Instncia do problema
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool writeInstance_Binary(char fileName[], Instance* instance)
+{
+	if (fileName == NULL || instance == NULL)
+	{
+		return false;
+	}
+
+	int** arrays[SNAPSHOT_SECTIONS];
+	long long counts[SNAPSHOT_SECTIONS];
+	getSnapshotArrays(instance, arrays, counts);
+
+	SnapshotHeader header;
+	memset(&header, 0, sizeof(SnapshotHeader));
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+
+	header.version = SNAPSHOT_VERSION;
+	header.byteOrder = SNAPSHOT_BYTE_ORDER;
+	header.numberOfJobs = instance->numberOfJobs;
+	header.numberOfMachines = instance->numberOfMachines;
+	header.numberOfOperations = instance->numberOfOperations;
+	header.numberOfExecutions = instance->numberOfExecutions;
+	header.numberOfSections = SNAPSHOT_SECTIONS;
+	header.headerSize = (int)sizeof(SnapshotHeader);
+
+	long long offset = alignOffset(sizeof(SnapshotHeader));
+
+	for (int s = 0; s < SNAPSHOT_SECTIONS; s++)
+	{
+		header.sections[s].offset = offset;
+		header.sections[s].count = counts[s];
+		header.sections[s].checksum = computeChecksum(*arrays[s], counts[s] * sizeof(int));
+
+		offset = alignOffset(offset + counts[s] * sizeof(int));
+	}
+
+	header.checksum = computeChecksum(&header, offsetof(SnapshotHeader, checksum));
+
+	FILE* file = fopen(fileName, "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	static const char padding[SNAPSHOT_ALIGNMENT] = { 0 };
+	bool written = fwrite(&header, sizeof(SnapshotHeader), 1, file) == 1;
+	long long position = sizeof(SnapshotHeader);
+
+	for (int s = 0; s < SNAPSHOT_SECTIONS && written; s++)
+	{
+		written = fwrite(padding, 1, (size_t)(header.sections[s].offset - position), file) == (size_t)(header.sections[s].offset - position)
+			&& fwrite(*arrays[s], sizeof(int), (size_t)counts[s], file) == (size_t)counts[s];
+
+		position = header.sections[s].offset + counts[s] * sizeof(int);
+	}
+
+	// o fecho tambm tem de funcionar, para garantir que os dados foram escritos
+	written = fclose(file) == 0 && written;
+
+	return written;
+}
+
+
+/**
+ * @brief	Carregar uma instncia compacta de um ficheiro binrio (snapshot), mapeado em memria
+ *
+ * O cabealho e todos os arrays so verificados (formato, verso, ordem de bytes, limites e somas de verificao) antes de serem usados.
+ * Cada array  copiado de uma s vez, sem alocar memria por registo.
+ * @param	fileName	Nome do ficheiro
+ * @return	Nova instncia (ou NULL se no for possvel ler o ficheiro, for de outra verso ou estiver corrompido)
+*/
+Instance* readInstance_Binary(char fileName[])
+{
+	MappedFile file;
+	if (!mapFile(fileName, &file))
+	{
+		return NULL;
+	}
+
+	SnapshotHeader header;
+	bool valid = file.size >= (long long)sizeof(SnapshotHeader);
+
+	if (valid)
+	{
+		memcpy(&header, file.data, sizeof(SnapshotHeader));
+
+		valid = memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 && header.version == SNAPSHOT_VERSION
+			&& header.byteOrder == SNAPSHOT_BYTE_ORDER && header.numberOfSections == SNAPSHOT_SECTIONS && header.headerSize == (int)sizeof(SnapshotHeader)
+			&& header.checksum == computeChecksum(&header, offsetof(SnapshotHeader, checksum))
+			&& header.numberOfJobs > 0 && header.numberOfMachines > 0 && header.numberOfOperations > 0 && header.numberOfExecutions > 0;
+	}
+
+	Instance* new = valid ? (Instance*)calloc(1, sizeof(Instance)) : NULL;
+	if (new == NULL)
+	{
+		unmapFile(&file);
+		return NULL;
+	}
+
+	new->numberOfJobs = header.numberOfJobs;
+	new->numberOfMachines = header.numberOfMachines;
+	new->numberOfOperations = header.numberOfOperations;
+	new->numberOfExecutions = header.numberOfExecutions;
+
+	int** arrays[SNAPSHOT_SECTIONS];
+	long long counts[SNAPSHOT_SECTIONS];
+	getSnapshotArrays(new, arrays, counts);
+
+	for (int s = 0; s < SNAPSHOT_SECTIONS && valid; s++)
+	{
+		SnapshotSection* section = &header.sections[s];
+
+		valid = section->count == counts[s] && section->offset >= (long long)sizeof(SnapshotHeader) && section->offset % SNAPSHOT_ALIGNMENT == 0
+			&& section->offset + counts[s] * (long long)sizeof(int) <= file.size
+			&& section->checksum == computeChecksum(file.data + section->offset, counts[s] * sizeof(int));
+
+		*arrays[s] = valid ? (int*)malloc(counts[s] * sizeof(int)) : NULL;
+		valid = valid && *arrays[s] != NULL;
+
+		if (valid)
+		{
+			memcpy(*arrays[s], file.data + section->offset, counts[s] * sizeof(int));
+		}
+	}
+
+	unmapFile(&file);
+
+	if (!valid || !validateInstance(new))
+	{
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	new->jobsCapacity = new->numberOfJobs;
+	new->operationsCapacity = new->numberOfOperations;
+	new->executionsCapacity = new->numberOfExecutions;
+
+	return new;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,482 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao escalonamento por iterated greedy (destruir e reconstruir o plano).
+ * @file	iterated-greedy.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Procurar a melhor posio (mquina e lugar na sequncia) para uma operao no escalonada, a partir das cabeas e caudas atuais
+ *
+ * As cabeas (tempos iniciais) e as caudas tm de corresponder ao plano sem a operao.
+ * Para cada intervalo entre duas operaes consecutivas de cada mquina elegvel, o tempo total estimado 
+ * max(fim do predecessor no trabalho, fim do anterior na mquina) + tempo de execuo + max(cauda do sucessor no trabalho, cauda do seguinte na mquina).
+ * S so considerados intervalos que no criam ciclos: o anterior na mquina no pode depender do sucessor no trabalho
+ * e o seguinte na mquina no pode ser um predecessor do predecessor no trabalho. Tambm no so considerados intervalos antes
+ * de operaes que comeam antes de frozenTime, para que o que j foi executado no seja alterado.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano avaliado (a operao no pode estar escalonada)
+ * @param	operation	ndice da operao a inserir
+ * @param	frozenTime	Instante at ao qual o plano j foi executado (0 se nenhuma parte do plano estiver fixa)
+ * @param	tails		Caudas das operaes escalonadas
+ * @param	machine		Apontador onde  guardada a mquina escolhida
+ * @param	runtime		Apontador onde  guardado o tempo de execuo nessa mquina
+ * @param	previous	Apontador onde  guardada a operao anterior na mquina (ou -1 se a operao fica em primeiro)
+ * @return	Tempo total estimado do plano com a operao nessa posio (ou -1 se no existir posio vlida)
+*/
+int getBestPosition_ForOperation(Instance* instance, Schedule* schedule, int operation, int frozenTime, int* tails, int* machine, int* runtime, int* previous)
+{
+	if (instance == NULL || schedule == NULL || tails == NULL || schedule->assignedMachine[operation] != -1)
+	{
+		return -1;
+	}
+
+	// operaes escalonadas anterior e seguinte no mesmo trabalho
+	int job = instance->operationJob[operation];
+	int jobPrevious = -1, jobNext = -1;
+
+	for (int o = operation - 1; o >= instance->jobStart[job]; o--)
+	{
+		if (schedule->assignedMachine[o] != -1)
+		{
+			jobPrevious = o;
+			break;
+		}
+	}
+
+	for (int o = operation + 1; o < instance->jobStart[job + 1]; o++)
+	{
+		if (schedule->assignedMachine[o] != -1)
+		{
+			jobNext = o;
+			break;
+		}
+	}
+
+	int head = schedule->releaseTime[operation];
+	if (jobPrevious != -1 && schedule->endTime[jobPrevious] > head)
+	{
+		head = schedule->endTime[jobPrevious];
+	}
+
+	int jobTail = jobNext == -1 ? 0 : tails[jobNext];
+	int bestMachine = -1, bestRuntime = 0, bestPrevious = -1, bestCost = 0;
+
+	for (int k = instance->eligibleStart[operation]; k < instance->eligibleStart[operation + 1]; k++)
+	{
+		int machine = instance->eligibleMachines[k];
+		int runtime = instance->eligibleRuntimes[k];
+		int previous = -1;
+		int next = schedule->firstInMachine[machine];
+
+		while (true)
+		{
+			// se existir caminho do sucessor no trabalho at ao anterior na mquina, o anterior comea depois do fim do sucessor
+			bool previousValid = previous == -1 || jobNext == -1 || (previous != jobNext && schedule->startTime[previous] < schedule->endTime[jobNext]);
+			// se existir caminho do seguinte na mquina at ao predecessor no trabalho, o predecessor comea depois do fim do seguinte
+			bool nextValid = next == -1 || jobPrevious == -1 || (next != jobPrevious && schedule->endTime[next] > schedule->startTime[jobPrevious]);
+			// o seguinte na mquina no pode ter comeado antes do instante fixo (a operao ficaria no passado, antes dele)
+			nextValid = nextValid && (next == -1 || schedule->startTime[next] >= frozenTime);
+
+			if (previousValid && nextValid)
+			{
+				int start = head;
+				int tail = jobTail;
+
+				if (previous != -1 && schedule->endTime[previous] > start)
+				{
+					start = schedule->endTime[previous];
+				}
+				else if (previous == -1 && schedule->machineReleaseTime[machine] > start)
+				{
+					start = schedule->machineReleaseTime[machine];
+				}
+
+				if (next != -1 && tails[next] > tail)
+				{
+					tail = tails[next];
+				}
+
+				int cost = start + runtime + tail;
+
+				if (bestMachine == -1 || cost < bestCost)
+				{
+					bestMachine = machine;
+					bestRuntime = runtime;
+					bestPrevious = previous;
+					bestCost = cost;
+				}
+			}
+
+			if (next == -1)
+			{
+				break;
+			}
+
+			previous = next;
+			next = schedule->nextInMachine[next];
+		}
+	}
+
+	if (bestMachine == -1)
+	{
+		return -1;
+	}
+
+	*machine = bestMachine;
+	*runtime = bestRuntime;
+	*previous = bestPrevious;
+
+	return bestCost;
+}
+
+
+/**
+ * @brief	Reinserir uma operao no escalonada na melhor posio (mquina e lugar na sequncia) de um plano
+ *
+ * O plano sem a operao  avaliado para obter as cabeas (tempos iniciais) e as caudas de todas as operaes,
+ * e a posio  escolhida por getBestPosition_ForOperation.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano (a operao no pode estar escalonada)
+ * @param	operation	ndice da operao a reinserir
+ * @param	frozenTime	Instante at ao qual o plano j foi executado (0 se nenhuma parte do plano estiver fixa)
+ * @param	tails		Memria auxiliar para as caudas (tamanho igual  quantidade de operaes)
+ * @return	Tempo total do plano depois de reinserir (ou -1 se no foi possvel)
+*/
+int reinsertOperation_AtBestPosition(Instance* instance, Schedule* schedule, int operation, int frozenTime, int* tails)
+{
+	if (instance == NULL || schedule == NULL || tails == NULL || schedule->assignedMachine[operation] != -1)
+	{
+		return -1;
+	}
+
+	if (evaluateSchedule(instance, schedule) < 0)
+	{
+		return -1;
+	}
+
+	getTails_OfSchedule(schedule, tails);
+
+	int machine, runtime, previous;
+	if (getBestPosition_ForOperation(instance, schedule, operation, frozenTime, tails, &machine, &runtime, &previous) < 0)
+	{
+		return -1;
+	}
+
+	insertOperation_AtSchedule(schedule, operation, machine, runtime, previous);
+
+	return evaluateSchedule(instance, schedule);
+}
+
+
+/**
+ * @brief	Estado de uma procura por iterated greedy, que pode ser continuada em vrias chamadas
+ *
+ * Guarda o plano atual da procura, a memria tabu, o gerador e a memria auxiliar, para que uma procura interrompida
+ * (por exemplo, no fim de cada intervalo do portflio) continue sem perder o que j visitou.
+*/
+struct IteratedGreedySearch
+{
+	Instance* instance;
+	Schedule* current; // plano atual da procura
+	Schedule* backup; // plano atual antes da iterao
+	int* tails; // caudas do plano (memria auxiliar para as reinseres)
+	int* removed;
+	int destroySize;
+	double temperature;
+	FingerprintSet* visited; // memria tabu
+	Random random;
+};
+
+
+/**
+ * @brief	Iniciar uma procura por iterated greedy a partir de um plano (ver continueIteratedGreedy)
+ * @param	instance			Instncia do problema
+ * @param	best				Plano inicial (se estiver vazio  construdo pela regra gulosa)
+ * @param	destroySize			Quantidade de operaes removidas em cada iterao
+ * @param	temperatureFactor	Fator de temperatura (0 aceita apenas planos iguais ou melhores)
+ * @param	seed				Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Estado da procura (ou NULL se no foi possvel)
+*/
+IteratedGreedySearch* startIteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, unsigned long long seed)
+{
+	if (instance == NULL || best == NULL)
+	{
+		return NULL;
+	}
+
+	if (best->numberOfScheduled < instance->numberOfOperations && buildSchedule_Greedy(instance, best) < 0)
+	{
+		return NULL;
+	}
+
+	if (evaluateSchedule(instance, best) < 0)
+	{
+		return NULL;
+	}
+
+	if (destroySize > instance->numberOfOperations)
+	{
+		destroySize = instance->numberOfOperations;
+	}
+
+	IteratedGreedySearch* search = (IteratedGreedySearch*)calloc(1, sizeof(IteratedGreedySearch));
+	if (search == NULL)
+	{
+		return NULL;
+	}
+
+	search->instance = instance;
+	search->current = newSchedule(instance);
+	search->backup = newSchedule(instance);
+	search->tails = (int*)malloc(instance->numberOfOperations * sizeof(int));
+	search->removed = (int*)malloc((destroySize + 1) * sizeof(int));
+	search->visited = newFingerprintSet(TABU_MEMORY_SIZE);
+
+	if (search->current == NULL || search->backup == NULL || search->tails == NULL || search->removed == NULL || search->visited == NULL)
+	{
+		cleanIteratedGreedy(&search);
+		return NULL;
+	}
+
+	// temperatura proporcional ao tempo mdio de execuo (Ruiz e Sttzle)
+	double totalRuntime = 0;
+	for (int k = 0; k < instance->numberOfExecutions; k++)
+	{
+		totalRuntime += instance->eligibleRuntimes[k];
+	}
+
+	search->destroySize = destroySize;
+	search->temperature = temperatureFactor * totalRuntime / (instance->numberOfExecutions * 10.0);
+	search->random = newRandom(seed);
+
+	restartIteratedGreedy(search, best);
+
+	return search;
+}
+
+
+/**
+ * @brief	Continuar a procura a partir de outro plano (a memria tabu  mantida)
+ * @param	search		Estado da procura
+ * @param	schedule	Plano avaliado da mesma instncia
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool restartIteratedGreedy(IteratedGreedySearch* search, Schedule* schedule)
+{
+	if (search == NULL || schedule == NULL)
+	{
+		return false;
+	}
+
+	copySchedule(search->current, schedule);
+	insertFingerprint_AtSet(search->visited, search->current->fingerprint);
+
+	return true;
+}
+
+
+/**
+ * @brief	Continuar uma procura por iterated greedy: em cada iterao so removidas operaes aleatrias do plano atual,
+ *			reinseridas uma a uma na melhor posio, e o resultado  aceite se for melhor ou, se for pior, com uma probabilidade
+ *			dada pela temperatura (como no simulated annealing, mas com temperatura constante)
+ *
+ * As impresses digitais dos ltimos TABU_MEMORY_SIZE planos visitados formam uma memria tabu: um plano repetido s  aceite
+ * se melhorar o melhor plano, o que evita que a procura ande em ciclos entre os mesmos planos.
+ * O sorteio da aceitao  feito antes da reconstruo, o que d o maior tempo total que pode ser aceite; a reconstruo  abandonada
+ * logo que o tempo total do plano parcial, ou o fim de uma operao reinserida mais o trabalho mnimo que falta ao seu trabalho,
+ * passa esse limite (reinserir operaes nunca diminui o tempo total). Com um limite partilhado (o tempo total do melhor plano
+ * de outras procuras), o limite de aceitao  calculado a partir do menor entre ele e o tempo total do plano atual.
+ * @param	search		Estado da procura
+ * @param	best		Plano avaliado onde  guardado o melhor plano encontrado
+ * @param	deadline	Instante (de getCurrentTime) em que a procura termina (0 para no limitar)
+ * @param	maxIterations	Quantidade mxima de iteraes (0 para no limitar)
+ * @param	cutoff		Tempo total partilhado, lido sem bloqueio em cada iterao (ou NULL)
+ * @param	jobTails	Trabalho mnimo depois de cada operao, de getJobTails_OfInstance (ou NULL para usar apenas o tempo total parcial)
+ * @param	callback	Funo chamada sempre que  encontrado um plano melhor (ou NULL), que pode devolver false para terminar a procura
+ * @param	context		Dados passados  funo callback
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel)
+*/
+int continueIteratedGreedy(IteratedGreedySearch* search, Schedule* best, long long deadline, int maxIterations, volatile int* cutoff, int* jobTails,
+	IncumbentCallback callback, void* context)
+{
+	if (search == NULL || best == NULL)
+	{
+		return -1;
+	}
+
+	Instance* instance = search->instance;
+	Schedule* current = search->current;
+	Schedule* backup = search->backup;
+	int* removed = search->removed;
+
+	for (int iteration = 0; maxIterations <= 0 || iteration < maxIterations; iteration++)
+	{
+		if (deadline > 0 && getCurrentTime() >= deadline)
+		{
+			break;
+		}
+
+		copySchedule(backup, current);
+
+		// critrio de aceitao, sorteado antes: um plano pior  aceite se (tempo total - referncia) < -temperatura * ln(u)
+		int reference = backup->makespan;
+		if (cutoff != NULL)
+		{
+			int shared = loadAtomic(cutoff);
+			reference = shared > 0 && shared < reference ? shared : reference;
+		}
+
+		int limit = reference;
+		if (search->temperature > 0)
+		{
+			double u = nextRandom_Float(&search->random);
+			double slack = u > 0 ? -search->temperature * log(u) : INT_MAX;
+
+			limit = slack >= (double)INT_MAX - reference ? INT_MAX : reference + (slack > 1 ? (int)ceil(slack) - 1 : 0);
+		}
+
+		// destruir: remover operaes aleatrias e distintas
+		int numberOfRemoved = 0;
+		for (int attempt = 0; numberOfRemoved < search->destroySize && attempt < search->destroySize * 4; attempt++)
+		{
+			int o = nextRandom_Int(&search->random, instance->numberOfOperations);
+
+			if (removeOperation_AtSchedule(current, o))
+			{
+				removed[numberOfRemoved++] = o;
+			}
+		}
+
+		// reconstruir: reinserir cada operao removida na melhor posio, enquanto o plano ainda pode ser aceite
+		int cost = 0;
+		for (int i = 0; i < numberOfRemoved && cost >= 0; i++)
+		{
+			cost = reinsertOperation_AtBestPosition(instance, current, removed[i], 0, search->tails);
+
+			int bound = cost;
+			if (cost >= 0 && jobTails != NULL && current->endTime[removed[i]] + jobTails[removed[i]] > bound)
+			{
+				bound = current->endTime[removed[i]] + jobTails[removed[i]];
+			}
+
+			if (bound > limit)
+			{
+				cost = -1;
+			}
+		}
+
+		// memria tabu: um plano visitado recentemente no volta a ser aceite, a menos que seja um novo melhor
+		if (numberOfRemoved == 0 || cost < 0 || (!insertFingerprint_AtSet(search->visited, current->fingerprint) && cost >= best->makespan))
+		{
+			copySchedule(current, backup);
+			continue;
+		}
+
+		if (cost < best->makespan)
+		{
+			copySchedule(best, current);
+
+			if (callback != NULL && !callback(instance, best, context)) // publicar o novo melhor plano
+			{
+				break;
+			}
+		}
+	}
+
+	return best->makespan;
+}
+
+
+/**
+ * @brief	Terminar uma procura por iterated greedy e limpar o seu estado da memria (a instncia e os planos recebidos no so limpos)
+ * @param	search	Apontador para o estado da procura
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanIteratedGreedy(IteratedGreedySearch** search)
+{
+	if (search == NULL || *search == NULL)
+	{
+		return false;
+	}
+
+	cleanSchedule(&(*search)->current);
+	cleanSchedule(&(*search)->backup);
+	free((*search)->tails);
+	free((*search)->removed);
+	cleanFingerprintSet(&(*search)->visited);
+	free(*search);
+
+	*search = NULL;
+
+	return true;
+}
+
+
+/**
+ * @brief	Melhorar um plano por iterated greedy (ver continueIteratedGreedy)
+ * @param	instance			Instncia do problema
+ * @param	best				Plano inicial, onde  guardado o melhor plano encontrado (se estiver vazio  construdo pela regra gulosa)
+ * @param	destroySize			Quantidade de operaes removidas em cada iterao
+ * @param	temperatureFactor	Fator de temperatura (0 aceita apenas planos iguais ou melhores)
+ * @param	deadline			Instante (de getCurrentTime) em que a procura termina (0 para no limitar)
+ * @param	maxIterations		Quantidade mxima de iteraes (0 para no limitar)
+ * @param	seed				Semente do gerador de nmeros pseudo-aleatrios
+ * @param	callback			Funo chamada sempre que  encontrado um plano melhor (ou NULL), que pode devolver false para terminar a procura
+ * @param	context				Dados passados  funo callback
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int improveSchedule_IteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, long long deadline, int maxIterations,
+	unsigned long long seed, IncumbentCallback callback, void* context)
+{
+	if (instance == NULL || best == NULL)
+	{
+		return -1;
+	}
+
+	if (deadline <= 0 && maxIterations <= 0) // no permitir uma procura sem fim
+	{
+		maxIterations = 1000;
+	}
+
+	IteratedGreedySearch* search = startIteratedGreedy(instance, best, destroySize, temperatureFactor, seed);
+	if (search == NULL)
+	{
+		return best->numberOfScheduled == instance->numberOfOperations ? evaluateSchedule(instance, best) : -1;
+	}
+
+	continueIteratedGreedy(search, best, deadline, maxIterations, NULL, NULL, callback, context);
+	cleanIteratedGreedy(&search);
+
+	return best->makespan;
+}
+
+
+/**
+ * @brief	Melhorar um plano por iterated greedy durante um tempo limitado (ver improveSchedule_IteratedGreedy)
+ * @param	instance			Instncia do problema
+ * @param	best				Plano inicial, onde  guardado o melhor plano encontrado (se estiver vazio  construdo pela regra gulosa)
+ * @param	destroySize			Quantidade de operaes removidas em cada iterao
+ * @param	temperatureFactor	Fator de temperatura (0 aceita apenas planos iguais ou melhores)
+ * @param	timeLimit			Tempo mximo de procura em milissegundos (0 para no limitar)
+ * @param	maxIterations		Quantidade mxima de iteraes (0 para no limitar)
+ * @param	seed				Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_IteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, long long timeLimit, int maxIterations, unsigned long long seed)
+{
+	long long deadline = timeLimit > 0 ? getCurrentTime() + timeLimit : 0;
+
+	return improveSchedule_IteratedGreedy(instance, best, destroySize, temperatureFactor, deadline, maxIterations, seed, NULL, NULL);
+}
\ No newline at end of file
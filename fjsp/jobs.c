@@ -59,6 +59,9 @@ Job* insertJob_AtStart(Job* head, Job* new)
 		head = new;
 	}
 
+	dirtyData.jobs = true; // a lista foi alterada desde que foi guardada
+	dirtyData.instance = true;
+
 	return head;
 }
 
@@ -95,6 +98,8 @@ bool updateJob(Job* head[], int id, const char* newName)
 		current = current->next;
 	}
 
+	dirtyData.jobs = true;
+
 	return true;
 }
 
@@ -119,6 +124,8 @@ bool deleteJob(Job* head[], int id)
 	{
 		*head = current->next;
 		free(current);
+		dirtyData.jobs = true;
+		dirtyData.instance = true;
 		return true;
 	}
 
@@ -135,6 +142,8 @@ bool deleteJob(Job* head[], int id)
 
 	previous->next = current->next; // desassociar o elemento da lista
 	free(current);
+	dirtyData.jobs = true;
+	dirtyData.instance = true;
 
 	return true;
 }
@@ -409,5 +418,8 @@ bool cleanJobs(Job* head[])
 		free(current);
 	}
 
+	dirtyData.jobs = true;
+	dirtyData.instance = true;
+
 	return false;
 }
\ No newline at end of file
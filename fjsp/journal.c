@@ -0,0 +1,859 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao dirio de alteraes, que guarda cada alterao aos dados sem reescrever os ficheiros .csv.
+ * @file	journal.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include "data-types.h"
+#include "lists.h"
+#include "hashing.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Cpia dos dados que  escrita nos ficheiros em segundo plano (compactao do dirio)
+*/
+typedef struct JournalCompaction
+{
+	Job* jobs;
+	Machine* machines;
+	Operation* operations;
+	ExecutionNode* table[HASH_TABLE_SIZE]; // NULL se a tabela hash no existia
+	int numberOfRecords; // registos do dirio j includos na cpia
+	DirtyData dirty; // dados alterados desde a ltima gravao (as posies da tabela hash alteradas so indicadas nos ns da cpia)
+	bool resetJournal; // o dirio foi esvaziado no incio, porque os registos no correspondiam aos ficheiros
+	bool succeeded;
+	volatile int finished;
+	Thread thread;
+} JournalCompaction;
+
+
+/**
+ * @brief	Dirio de alteraes
+ *
+ * As alteraes ficam em memria at serem JOURNAL_SYNC_BATCH ou at os dados serem guardados, e so ento acrescentadas
+ * ao fim do ficheiro e sincronizadas com o disco de uma s vez. Ao carregar os dados, os registos so repostos sobre os ficheiros .csv.
+ * Quando o dirio fica grande, os ficheiros so reescritos numa thread a partir de uma cpia dos dados, e os registos includos
+ * na cpia so retirados do dirio no fim.
+*/
+struct Journal
+{
+	char fileName[FILE_LINE_SIZE];
+	FILE* file; // aberto para acrescentar registos
+	JournalRecord pending[JOURNAL_SYNC_BATCH]; // registos ainda no escritos no ficheiro
+	int numberOfPending;
+	int numberOfRecords; // registos escritos no ficheiro
+	bool synchronized; // os ficheiros .csv com os registos do dirio correspondem aos dados em memria
+	JournalCompaction* compaction; // compactao em curso (ou NULL)
+};
+
+
+#pragma region registos
+
+/**
+ * @brief	Calcular a soma de verificao de um registo do dirio (FNV-1a de todos os campos, exceto a prpria soma)
+ * @param	record	Registo do dirio
+ * @return	Soma de verificao
+*/
+static unsigned int computeRecordChecksum(JournalRecord* record)
+{
+	unsigned char* bytes = (unsigned char*)record;
+	unsigned int checksum = 2166136261u;
+
+	for (size_t i = 0; i < offsetof(JournalRecord, checksum); i++)
+	{
+		checksum = (checksum ^ bytes[i]) * 16777619u;
+	}
+
+	return checksum;
+}
+
+
+/**
+ * @brief	Inserir ou atualizar um trabalho na lista de trabalhos
+ * @param	jobs	Apontador para a lista de trabalhos
+ * @param	id		Identificador do trabalho
+ * @param	name	Nome do trabalho
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool setJob(Job** jobs, int id, const char* name)
+{
+	Job* job = *jobs;
+
+	while (job != NULL && job->id != id)
+	{
+		job = job->next;
+	}
+
+	if (job == NULL) // se o trabalho no existir,  inserido
+	{
+		job = (Job*)malloc(sizeof(Job));
+		if (job == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		job->id = id;
+		job->next = NULL;
+		*jobs = insertJob_AtStart(*jobs, job);
+	}
+
+	strncpy(job->name, name, NAME_SIZE - 1);
+	job->name[NAME_SIZE - 1] = '\0'; // assegura que o nome termina com '\0'
+	dirtyData.jobs = true;
+
+	return true;
+}
+
+
+/**
+ * @brief	Inserir ou atualizar uma mquina na lista de mquinas
+ * @param	machines	Apontador para a lista de mquinas
+ * @param	id			Identificador da mquina
+ * @param	name		Nome da mquina
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool setMachine(Machine** machines, int id, const char* name)
+{
+	Machine* machine = *machines;
+
+	while (machine != NULL && machine->id != id)
+	{
+		machine = machine->next;
+	}
+
+	if (machine == NULL) // se a mquina no existir,  inserida
+	{
+		machine = (Machine*)malloc(sizeof(Machine));
+		if (machine == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		machine->id = id;
+		machine->next = NULL;
+		*machines = insertMachine_AtStart(*machines, machine);
+	}
+
+	strncpy(machine->name, name, NAME_SIZE - 1);
+	machine->name[NAME_SIZE - 1] = '\0'; // assegura que o nome termina com '\0'
+	dirtyData.machines = true;
+
+	return true;
+}
+
+
+/**
+ * @brief	Inserir ou atualizar uma operao na lista de operaes
+ * @param	operations		Apontador para a lista de operaes
+ * @param	operationID		Identificador da operao
+ * @param	jobID			Identificador do trabalho
+ * @param	position		Posio da operao no trabalho
+ * @param	name			Nome da operao
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool setOperation(Operation** operations, int operationID, int jobID, int position, const char* name)
+{
+	Operation* operation = getOperation(*operations, operationID);
+
+	if (operation == NULL) // se a operao no existir,  inserida
+	{
+		operation = (Operation*)malloc(sizeof(Operation));
+		if (operation == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		operation->operationID = operationID;
+		operation->next = NULL;
+		*operations = insertOperation_AtStart(*operations, operation);
+	}
+
+	operation->jobID = jobID;
+	operation->position = position;
+	strncpy(operation->name, name, NAME_SIZE - 1);
+	operation->name[NAME_SIZE - 1] = '\0'; // assegura que o nome termina com '\0'
+	dirtyData.operations = true;
+	dirtyData.instance = true;
+	operationsVersion++;
+
+	return true;
+}
+
+
+/**
+ * @brief	Inserir ou atualizar o tempo de uma execuo na tabela hash
+ * @param	table			Tabela hash das execues de operaes
+ * @param	operationID		Identificador da operao
+ * @param	machineID		Identificador da mquina
+ * @param	runtime			Tempo de execuo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool setExecution(ExecutionNode* table[], int operationID, int machineID, int runtime)
+{
+	if (*table == NULL && newExecutionsTable_Empty(table) == NULL) // a tabela ainda no existe (ficheiro das execues em falta)
+	{
+		return false;
+	}
+
+	if (searchExecution_AtTable(table, operationID, machineID) != NULL)
+	{
+		return updateRuntime_ByOperation_AtTable((ExecutionNode***)table, operationID, machineID, runtime);
+	}
+
+	Execution* execution = newExecution(operationID, machineID, runtime);
+	if (execution == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	insertExecution_AtTable(table, execution);
+
+	if (searchExecution_AtTable(table, operationID, machineID) != execution) // no foi inserida
+	{
+		free(execution);
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Aplicar um registo do dirio aos dados em memria
+ * @param	record		Registo do dirio
+ * @param	jobs		Apontador para a lista de trabalhos
+ * @param	machines	Apontador para a lista de mquinas
+ * @param	operations	Apontador para a lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool applyRecord(JournalRecord* record, Job** jobs, Machine** machines, Operation** operations, ExecutionNode* table[])
+{
+	int operationID = -1;
+
+	switch (record->action)
+	{
+	case JOURNAL_SET_JOB:
+		return setJob(jobs, record->first, record->name);
+
+	case JOURNAL_DELETE_JOB:
+		deleteJob(jobs, record->first);
+
+		// remover as operaes do trabalho e as respetivas execues
+		while ((operationID = deleteOperation_ByJob(operations, record->first)) != -1)
+		{
+			deleteExecutions_ByOperation_AtTable((ExecutionNode***)table, operationID);
+		}
+
+		return true;
+
+	case JOURNAL_SET_MACHINE:
+		return setMachine(machines, record->first, record->name);
+
+	case JOURNAL_DELETE_MACHINE:
+		deleteMachine(machines, record->first);
+		deleteExecutions_ByMachine_AtTable((ExecutionNode***)table, record->first);
+		return true;
+
+	case JOURNAL_SET_OPERATION:
+		return setOperation(operations, record->first, record->second, record->third, record->name);
+
+	case JOURNAL_DELETE_OPERATION:
+		deleteOperation(operations, record->first);
+		deleteExecutions_ByOperation_AtTable((ExecutionNode***)table, record->first);
+		return true;
+
+	case JOURNAL_SET_EXECUTION:
+		return setExecution(table, record->first, record->second, record->third);
+
+	default:
+		return false;
+	}
+}
+
+#pragma endregion
+
+
+#pragma region ficheiro do dirio
+
+/**
+ * @brief	Escrever os registos pendentes no fim do ficheiro do dirio e sincroniz-lo com o disco
+ * @param	journal		Dirio de alteraes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool flushJournal(Journal* journal)
+{
+	if (journal->numberOfPending == 0)
+	{
+		return true;
+	}
+
+	bool flushed = journal->file != NULL
+		&& fwrite(journal->pending, sizeof(JournalRecord), journal->numberOfPending, journal->file) == (size_t)journal->numberOfPending
+		&& syncFile(journal->file);
+
+	if (!flushed) // o ficheiro pode ter ficado com registos a meio, por isso os dados so reescritos por completo na prxima gravao
+	{
+		journal->synchronized = false;
+	}
+
+	journal->numberOfRecords += journal->numberOfPending;
+	journal->numberOfPending = 0;
+
+	return flushed;
+}
+
+
+/**
+ * @brief	Reescrever o ficheiro do dirio apenas com parte dos registos (substituindo o ficheiro de forma atmica)
+ * @param	journal		Dirio de alteraes
+ * @param	first		Primeiro registo mantido
+ * @param	count		Quantidade de registos mantidos
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool keepJournalRecords(Journal* journal, int first, int count)
+{
+	if (journal->file != NULL)
+	{
+		fclose(journal->file);
+		journal->file = NULL;
+	}
+
+	char temporaryFileName[FILE_LINE_SIZE + sizeof(TEMPORARY_FILENAME_SUFFIX)];
+	snprintf(temporaryFileName, sizeof(temporaryFileName), "%s%s", journal->fileName, TEMPORARY_FILENAME_SUFFIX);
+
+	FILE* source = count > 0 ? fopen(journal->fileName, "rb") : NULL;
+	FILE* destination = fopen(temporaryFileName, "wb");
+
+	bool kept = destination != NULL && (count == 0 || (source != NULL && fseek(source, (long)first * (long)sizeof(JournalRecord), SEEK_SET) == 0));
+
+	JournalRecord records[JOURNAL_SYNC_BATCH];
+
+	for (int copied = 0; kept && copied < count; copied += JOURNAL_SYNC_BATCH)
+	{
+		size_t chunk = count - copied < JOURNAL_SYNC_BATCH ? count - copied : JOURNAL_SYNC_BATCH;
+		kept = fread(records, sizeof(JournalRecord), chunk, source) == chunk && fwrite(records, sizeof(JournalRecord), chunk, destination) == chunk;
+	}
+
+	kept = kept && syncFile(destination);
+
+	if (source != NULL)
+	{
+		fclose(source);
+	}
+
+	if (destination != NULL)
+	{
+		kept = fclose(destination) == 0 && kept;
+	}
+
+	kept = kept && replaceFile(temporaryFileName, journal->fileName);
+
+	if (!kept)
+	{
+		remove(temporaryFileName);
+	}
+	else
+	{
+		journal->numberOfRecords = count;
+	}
+
+	journal->file = fopen(journal->fileName, "ab");
+
+	return kept && journal->file != NULL;
+}
+
+#pragma endregion
+
+
+#pragma region compactao
+
+/**
+ * @brief	Copiar os dados em memria para a compactao, j que as listas continuam a ser alteradas durante a escrita dos ficheiros
+ * @param	compaction	Compactao do dirio
+ * @param	jobs		Lista de trabalhos
+ * @param	machines	Lista de mquinas
+ * @param	operations	Lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool copyData_ToCompaction(JournalCompaction* compaction, Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[])
+{
+	Job** nextJob = &compaction->jobs;
+	for (Job* current = jobs; current != NULL; current = current->next, nextJob = &(*nextJob)->next)
+	{
+		if ((*nextJob = (Job*)malloc(sizeof(Job))) == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		**nextJob = *current;
+		(*nextJob)->next = NULL;
+	}
+
+	Machine** nextMachine = &compaction->machines;
+	for (Machine* current = machines; current != NULL; current = current->next, nextMachine = &(*nextMachine)->next)
+	{
+		if ((*nextMachine = (Machine*)malloc(sizeof(Machine))) == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		**nextMachine = *current;
+		(*nextMachine)->next = NULL;
+	}
+
+	Operation** nextOperation = &compaction->operations;
+	for (Operation* current = operations; current != NULL; current = current->next, nextOperation = &(*nextOperation)->next)
+	{
+		if ((*nextOperation = (Operation*)malloc(sizeof(Operation))) == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		**nextOperation = *current;
+		(*nextOperation)->next = NULL;
+	}
+
+	if (table == NULL || *table == NULL) // a tabela hash no existe
+	{
+		return true;
+	}
+
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		if ((compaction->table[i] = newExecutionNode()) == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		compaction->table[i]->numberOfExecutions = table[i]->numberOfExecutions;
+		compaction->table[i]->dirty = table[i]->dirty;
+
+		Execution** nextExecution = &compaction->table[i]->start;
+		for (Execution* current = table[i]->start; current != NULL; current = current->next, nextExecution = &(*nextExecution)->next)
+		{
+			if ((*nextExecution = (Execution*)malloc(sizeof(Execution))) == NULL) // se no houver memria para alocar
+			{
+				return false;
+			}
+
+			**nextExecution = *current;
+			(*nextExecution)->next = NULL;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Libertar a cpia dos dados da compactao
+ *
+ * As listas so libertadas diretamente, porque as funes clean indicariam que os dados em memria foram alterados.
+ * @param	compaction	Compactao do dirio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool cleanCompactionData(JournalCompaction* compaction)
+{
+	while (compaction->jobs != NULL)
+	{
+		Job* next = compaction->jobs->next;
+		free(compaction->jobs);
+		compaction->jobs = next;
+	}
+
+	while (compaction->machines != NULL)
+	{
+		Machine* next = compaction->machines->next;
+		free(compaction->machines);
+		compaction->machines = next;
+	}
+
+	while (compaction->operations != NULL)
+	{
+		Operation* next = compaction->operations->next;
+		free(compaction->operations);
+		compaction->operations = next;
+	}
+
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		if (compaction->table[i] != NULL)
+		{
+			cleanExecutions_List(&compaction->table[i]->start);
+			free(compaction->table[i]);
+			compaction->table[i] = NULL;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Escrever nos ficheiros .csv e na instncia binria os dados alterados da cpia (executada numa thread)
+ *
+ * Como os registos do dirio definem o estado final de cada entidade, voltar a rep-los sobre ficheiros que j os incluem
+ * d o mesmo resultado.
+ * @param	argument	Compactao do dirio
+*/
+static void compactJournal(void* argument)
+{
+	JournalCompaction* compaction = (JournalCompaction*)argument;
+
+	bool succeeded = writeData_Changed(compaction->jobs, compaction->machines, compaction->operations, compaction->table, &compaction->dirty);
+
+	cleanCompactionData(compaction);
+
+	compaction->succeeded = succeeded;
+	storeAtomic(&compaction->finished, 1);
+}
+
+
+/**
+ * @brief	Iniciar a compactao do dirio em segundo plano
+ * @param	journal		Dirio de alteraes
+ * @param	jobs		Lista de trabalhos
+ * @param	machines	Lista de mquinas
+ * @param	operations	Lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool startCompaction(Journal* journal, Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[])
+{
+	JournalCompaction* compaction = (JournalCompaction*)calloc(1, sizeof(JournalCompaction));
+	if (compaction == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	if (!copyData_ToCompaction(compaction, jobs, machines, operations, table))
+	{
+		cleanCompactionData(compaction);
+		free(compaction);
+		return false;
+	}
+
+	if (!journal->synchronized) // os registos do dirio no correspondem aos dados que vo ser escritos
+	{
+		journal->numberOfPending = 0;
+
+		if (!keepJournalRecords(journal, 0, 0))
+		{
+			cleanCompactionData(compaction);
+			free(compaction);
+			return false;
+		}
+
+		journal->synchronized = true;
+		compaction->resetJournal = true;
+	}
+
+	compaction->numberOfRecords = journal->numberOfRecords;
+	compaction->dirty = dirtyData;
+
+	if (!startThread(&compaction->thread, compactJournal, compaction))
+	{
+		journal->synchronized = !compaction->resetJournal;
+		cleanCompactionData(compaction);
+		free(compaction);
+		return false;
+	}
+
+	journal->compaction = compaction;
+
+	// as alteraes seguintes ficam para a prxima gravao (se a compactao falhar, as da cpia so repostas no fim)
+	dirtyData.jobs = false;
+	dirtyData.machines = false;
+	dirtyData.operations = false;
+	dirtyData.executions = false;
+	dirtyData.instance = false;
+
+	for (int i = 0; table != NULL && *table != NULL && i < HASH_TABLE_SIZE; i++)
+	{
+		table[i]->dirty = false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Terminar a compactao do dirio, retirando do dirio os registos que j esto nos ficheiros
+ * @param	journal		Dirio de alteraes
+ * @param	wait		Esperar pelo fim da compactao (se false, s termina a compactao se a thread j acabou)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool finishCompaction(Journal* journal, bool wait)
+{
+	JournalCompaction* compaction = journal->compaction;
+
+	if (compaction == NULL || (!wait && !loadAtomic(&compaction->finished)))
+	{
+		return true;
+	}
+
+	joinThread(compaction->thread);
+	journal->compaction = NULL;
+
+	bool finished = compaction->succeeded;
+
+	// os ficheiros que no foram escritos continuam por gravar (na tabela hash, a falha faz com que seja escrita por completo)
+	dirtyData.jobs = dirtyData.jobs || compaction->dirty.jobs;
+	dirtyData.machines = dirtyData.machines || compaction->dirty.machines;
+	dirtyData.operations = dirtyData.operations || compaction->dirty.operations;
+	dirtyData.executions = dirtyData.executions || compaction->dirty.executions;
+	dirtyData.instance = dirtyData.instance || compaction->dirty.instance;
+
+	if (compaction->succeeded)
+	{
+		finished = keepJournalRecords(journal, compaction->numberOfRecords, journal->numberOfRecords - compaction->numberOfRecords);
+	}
+	else if (compaction->resetJournal) // os ficheiros no correspondem aos dados, por isso so reescritos de novo na prxima gravao
+	{
+		journal->numberOfPending = 0;
+		journal->synchronized = false;
+		keepJournalRecords(journal, 0, 0);
+	}
+
+	free(compaction);
+
+	return finished;
+}
+
+#pragma endregion
+
+
+#pragma region dirio de alteraes
+
+/**
+ * @brief	Abrir o dirio de alteraes
+ *
+ * At os dados serem carregados (e o dirio reposto) ou guardados, as alteraes no so registadas,
+ * porque os dados em memria no correspondem aos ficheiros.
+ * @param	fileName	Nome do ficheiro do dirio
+ * @return	Dirio aberto (ou NULL se no foi possvel abrir o ficheiro)
+*/
+Journal* openJournal(char fileName[])
+{
+	if (fileName == NULL)
+	{
+		return NULL;
+	}
+
+	Journal* journal = (Journal*)calloc(1, sizeof(Journal));
+	if (journal == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	strncpy(journal->fileName, fileName, FILE_LINE_SIZE - 1);
+	journal->fileName[FILE_LINE_SIZE - 1] = '\0'; // assegura que o nome termina com '\0'
+
+	journal->file = fopen(journal->fileName, "ab");
+	if (journal->file == NULL)
+	{
+		free(journal);
+		return NULL;
+	}
+
+	journal->synchronized = false;
+
+	return journal;
+}
+
+
+/**
+ * @brief	Registar uma alterao aos dados no dirio
+ *
+ * O registo s  escrito no ficheiro quando houver JOURNAL_SYNC_BATCH registos pendentes ou quando os dados forem guardados.
+ * @param	journal		Dirio de alteraes
+ * @param	action		Tipo de alterao
+ * @param	first		Identificador do trabalho, da mquina ou da operao (ou operao da execuo)
+ * @param	second		Trabalho da operao ou mquina da execuo (0 se no se aplicar)
+ * @param	third		Posio da operao ou tempo da execuo (0 se no se aplicar)
+ * @param	name		Nome do trabalho, da mquina ou da operao (ou NULL)
+ * @return	Booleano para o resultado da funo (se a alterao foi registada ou no)
+*/
+bool appendRecord_AtJournal(Journal* journal, JournalAction action, int first, int second, int third, const char* name)
+{
+	if (journal == NULL)
+	{
+		return false;
+	}
+
+	finishCompaction(journal, false);
+
+	if (!journal->synchronized) // os dados em memria so escritos por completo na prxima gravao
+	{
+		return false;
+	}
+
+	JournalRecord* record = &journal->pending[journal->numberOfPending];
+
+	memset(record, 0, sizeof(JournalRecord)); // o nome  escrito por completo, por isso os bytes que sobram ficam a zero
+	record->action = action;
+	record->first = first;
+	record->second = second;
+	record->third = third;
+
+	if (name != NULL)
+	{
+		strncpy(record->name, name, NAME_SIZE - 1);
+	}
+
+	record->checksum = computeRecordChecksum(record);
+	journal->numberOfPending++;
+
+	if (journal->numberOfPending == JOURNAL_SYNC_BATCH)
+	{
+		return flushJournal(journal);
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Repor os registos do dirio sobre os dados acabados de carregar dos ficheiros
+ *
+ * A leitura termina no primeiro registo incompleto ou com a soma de verificao errada, que  retirado do ficheiro
+ * juntamente com os seguintes. As alteraes ainda pendentes so descartadas, tal como os restantes dados em memria.
+ * @param	journal		Dirio de alteraes
+ * @param	jobs		Apontador para a lista de trabalhos
+ * @param	machines	Apontador para a lista de mquinas
+ * @param	operations	Apontador para a lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @return	Quantidade de registos repostos (ou -1 se no foi possvel ler o dirio)
+*/
+int replayJournal(Journal* journal, Job** jobs, Machine** machines, Operation** operations, ExecutionNode* table[])
+{
+	if (journal == NULL || jobs == NULL || machines == NULL || operations == NULL || table == NULL)
+	{
+		return -1;
+	}
+
+	finishCompaction(journal, true);
+	journal->numberOfPending = 0;
+
+	FILE* file = fopen(journal->fileName, "rb");
+	if (file == NULL)
+	{
+		return -1;
+	}
+
+	JournalRecord record;
+	int replayed = 0;
+
+	while (fread(&record, sizeof(JournalRecord), 1, file) == 1 && record.checksum == computeRecordChecksum(&record))
+	{
+		applyRecord(&record, jobs, machines, operations, table);
+		replayed++;
+	}
+
+	fseek(file, 0, SEEK_END);
+	bool complete = ftell(file) == (long)replayed * (long)sizeof(JournalRecord);
+
+	fclose(file);
+
+	journal->numberOfRecords = replayed;
+
+	// retirar o registo escrito a meio, para que os registos seguintes no fiquem depois dele
+	journal->synchronized = complete || keepJournalRecords(journal, 0, replayed);
+
+	return replayed;
+}
+
+
+/**
+ * @brief	Guardar as alteraes aos dados
+ *
+ * Normalmente s escreve os registos pendentes no fim do dirio, em tempo proporcional s alteraes.
+ * Quando o dirio tem JOURNAL_COMPACTION_THRESHOLD registos, ou os dados em memria no correspondem aos ficheiros,
+ * os ficheiros com dados alterados so reescritos em segundo plano.
+ * @param	journal		Dirio de alteraes
+ * @param	jobs		Lista de trabalhos
+ * @param	machines	Lista de mquinas
+ * @param	operations	Lista de operaes
+ * @param	table		Tabela hash das execues de operaes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool saveJournal(Journal* journal, Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[])
+{
+	if (journal == NULL)
+	{
+		return false;
+	}
+
+	finishCompaction(journal, false);
+	flushJournal(journal);
+
+	if (journal->synchronized && (journal->numberOfRecords < JOURNAL_COMPACTION_THRESHOLD || journal->compaction != NULL))
+	{
+		return true; // o dirio j tem todas as alteraes
+	}
+
+	finishCompaction(journal, true); // s existe uma compactao de cada vez
+
+	return startCompaction(journal, jobs, machines, operations, table);
+}
+
+
+/**
+ * @brief	Indicar que os dados em memria deixaram de corresponder aos ficheiros (por exemplo, ao carregar dados de exemplo)
+ *
+ * As alteraes pendentes so descartadas e deixam de ser registadas at os dados serem carregados ou guardados.
+ * @param	journal		Dirio de alteraes
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool invalidateJournal(Journal* journal)
+{
+	if (journal == NULL)
+	{
+		return false;
+	}
+
+	finishCompaction(journal, true); // os ficheiros podem ser carregados a seguir
+
+	journal->numberOfPending = 0;
+	journal->synchronized = false;
+
+	return true;
+}
+
+
+/**
+ * @brief	Fechar o dirio de alteraes, esperando pela compactao em curso
+ * @param	journal		Apontador para o dirio
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool closeJournal(Journal** journal)
+{
+	if (journal == NULL || *journal == NULL)
+	{
+		return false;
+	}
+
+	finishCompaction(*journal, true);
+	flushJournal(*journal);
+
+	if ((*journal)->file != NULL)
+	{
+		fclose((*journal)->file);
+	}
+
+	free(*journal);
+	*journal = NULL;
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -65,9 +65,6 @@ bool searchOperation(Operation* head, int operationID);
 bool searchOperation_ByJob(Operation* head, int jobID);
 Operation* getOperation(Operation* head, int operationID);
 Operation* getOperation_ByJob(Operation* head, int operationID, int jobID);
-int getMinTime_ToCompleteJob(Operation* operations, Execution* executions, int jobID, Execution** minExecutions);
-int getMaxTime_ToCompleteJob(Operation* operations, Execution* executions, int jobID, Execution** maxExecutions);
-float getAverageTime_ToCompleteOperation(Execution* head, int operationID);
 int countOperations(Operation* head);
 bool cleanOperations(Operation* head[]);
 
@@ -106,7 +103,7 @@ WorkPlan* insertWorkPlan_AtStart(WorkPlan* head, WorkPlan* new);
 WorkPlan* insertWorkPlan_ByJob_AtList(WorkPlan* head, WorkPlan* new);
 bool displayWorkPlans(WorkPlan* head);
 WorkPlan* sortWorkPlans_ByJob(WorkPlan* head);
-WorkPlan* getAllWorkPlans(Job* jobs, Operation* operations, Execution* executions);
+WorkPlan* getAllWorkPlans(Job* jobs, Operation* operations, ExecutionNode* table[]);
 int getFullTimeOfPlan(WorkPlan* head);
 
 #pragma endregion
@@ -134,6 +131,27 @@ FileCell* insertFileCell_ByMachine(FileCell* head, FileCell* new);
 FileCell* sortFileCells_ByMachine(FileCell* head);
 FileCell* getCellsToExport(Cell plan[][MAX_TIME]);
 bool exportPlan(char fileName[], FileCell* head);
+bool cleanFileCells(FileCell* head[]);
+
+#pragma endregion
+
+
+#pragma region dirio de alteraes
+
+Journal* openJournal(char fileName[]);
+bool appendRecord_AtJournal(Journal* journal, JournalAction action, int first, int second, int third, const char* name);
+int replayJournal(Journal* journal, Job** jobs, Machine** machines, Operation** operations, ExecutionNode* table[]);
+bool saveJournal(Journal* journal, Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[]);
+bool invalidateJournal(Journal* journal);
+bool closeJournal(Journal** journal);
+
+#pragma endregion
+
+
+#pragma region gravao dos dados alterados
+
+bool clearDirtyData(ExecutionNode* table[]);
+bool writeData_Changed(Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[], DirtyData* dirty);
 
 #pragma endregion
 
@@ -59,6 +59,9 @@ Machine* insertMachine_AtStart(Machine* head, Machine* new)
 		head = new;
 	}
 
+	dirtyData.machines = true; // a lista foi alterada desde que foi guardada
+	dirtyData.instance = true;
+
 	return head;
 }
 
@@ -95,6 +98,8 @@ bool updateMachine(Machine* head[], int id, const char* newName)
 		current = current->next;
 	}
 
+	dirtyData.machines = true;
+
 	return true;
 }
 
@@ -119,6 +124,8 @@ bool deleteMachine(Machine* head[], int id)
 	{
 		*head = current->next;
 		free(current);
+		dirtyData.machines = true;
+		dirtyData.instance = true;
 		return true;
 	}
 
@@ -135,6 +142,8 @@ bool deleteMachine(Machine* head[], int id)
 
 	previous->next = current->next; // desassociar o elemento da lista
 	free(current);
+	dirtyData.machines = true;
+	dirtyData.instance = true;
 
 	return true;
 }
@@ -409,5 +418,8 @@ bool cleanMachines(Machine* head[])
 		free(current);
 	}
 
+	dirtyData.machines = true;
+	dirtyData.instance = true;
+
 	return false;
 }
\ No newline at end of file
@@ -13,10 +13,12 @@
 */
 
 #include <stdio.h>
+#include <time.h>
 #include <locale.h>
 #include "data-types.h"
 #include "lists.h"
 #include "hashing.h"
+#include "scheduling.h"
 #include "utils.h"
 
 
@@ -40,6 +42,16 @@ int main()
 	// matriz do plano de produo
 	Cell plan[NUMBER_MACHINES][MAX_TIME];
 
+	// ltimo plano proposto por intervalos de tempo (reparado quando os dados mudam)
+	Instance* currentInstance = NULL;
+	Schedule* currentSchedule = NULL;
+
+	// exportador dos planos por intervalos de tempo (o formato pode ser alterado na opo 31)
+	PlanExporter* planExporter = newPlanExporter(PLAN_FILENAME_TEXT, PLAN_FORMAT_CSV);
+
+	// dirio das alteraes aos dados (reposto ao carregar os dados e escrito ao guardar)
+	Journal* journal = openJournal(JOURNAL_FILENAME);
+
 	int menuOption = 0;
 
 	do
@@ -65,7 +77,20 @@ int main()
 		printf("   15 -> Trocar ordem de 2 operaes\n");
 		printf("   16 -> Remover uma operao\n");
 		printf("   17 -> Guardar dados\n");
-		printf("   18 -> Sobre\n\n");
+		printf("   18 -> Sobre\n");
+		printf("   19 -> Proposta de escalonamento otimizada (iterated greedy)\n");
+		printf("   20 -> Proposta de escalonamento com tempo limite\n");
+		printf("   21 -> Proposta de escalonamento em paralelo (portflio de algoritmos)\n");
+		printf("   22 -> Proposta de escalonamento em paralelo reprodutvel\n");
+		printf("   23 -> Inserir novos trabalhos no plano atual (escalonamento online)\n");
+		printf("   24 -> Proposta de escalonamento por horizonte deslizante (instncias grandes)\n");
+		printf("   25 -> Proposta de escalonamento por shifting bottleneck (determinstica)\n");
+		printf("   26 -> Propostas de escalonamento multiobjetivo (frente de Pareto)\n");
+		printf("   27 -> Proposta de escalonamento por algoritmo memtico\n");
+		printf("   28 -> Proposta de escalonamento carregando a instncia diretamente dos ficheiros\n");
+		printf("   29 -> Proposta de escalonamento para uma instncia de benchmark (.fjs)\n");
+		printf("   30 -> Proposta de escalonamento carregando a instncia guardada em binrio\n");
+		printf("   31 -> Escolher o formato de exportao dos planos\n\n");
 		printf("    Lus Pereira | 2022\n\n");
 		printf("--------------------------------------\n");
 		printf("Escolha uma das opes acima: ");
@@ -92,6 +117,11 @@ int main()
 				cleanOperations(&operations);
 				cleanExecutions_Table(&executionsTable);
 				// FALTA WORK PLANS ?
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+
+				// os dados de exemplo no correspondem aos ficheiros
+				invalidateJournal(journal);
 
 				// carregar listas em memria a partir de dados em cdigo
 				jobs = readJobs_Example();
@@ -115,6 +145,11 @@ int main()
 				cleanOperations(&operations);
 				cleanExecutions_Table(&executionsTable);
 				// FALTA WORK PLANS ?
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+
+				// as alteraes por guardar so descartadas
+				invalidateJournal(journal);
 
 				// carregar listas em memria a partir de ficheiros .csv
 				jobs = readJobs_Text(JOBS_FILENAME_TEXT);
@@ -122,7 +157,18 @@ int main()
 				operations = readOperations_Text(OPERATIONS_FILENAME_TEXT);
 
 				// carregar tabela hash em memria a partir de um ficheiro .csv
-				*executionsTable = readExecutions_AtTable_Text(EXECUTIONS_FILENAME_TEXT, executionsTable);
+				int duplicatedExecutions = 0;
+				*executionsTable = readExecutions_AtTable_Text(EXECUTIONS_FILENAME_TEXT, executionsTable, &duplicatedExecutions);
+
+				// os dados em memria correspondem agora aos ficheiros
+				clearDirtyData(executionsTable);
+
+				// repor as alteraes registadas no dirio depois de os ficheiros .csv terem sido escritos
+				int replayedRecords = replayJournal(journal, &jobs, &machines, &operations, executionsTable);
+				if (replayedRecords > 0)
+				{
+					printf("Foram repostas %d alteraes registadas no dirio.\n", replayedRecords);
+				}
 
 				// carregar listas em memria a partir de ficheiros binrios
 				//jobs = readJobs_Binary(JOBS_FILENAME_BINARY);
@@ -130,7 +176,12 @@ int main()
 				//operations = readOperations_Binary(OPERATIONS_FILENAME_BINARY);
 
 				// carregar tabela hash em memria a partir de um ficheiro binrio
-				//*executionsTable = readExecutions_AtTable_Binary(EXECUTIONS_FILENAME_BINARY, executionsTable);
+				//*executionsTable = readExecutions_AtTable_Binary(EXECUTIONS_FILENAME_BINARY, executionsTable, &duplicatedExecutions);
+
+				if (duplicatedExecutions > 0)
+				{
+					printf("Foram ignoradas %d execues repetidas (mesma operao e mquina).\n", duplicatedExecutions);
+				}
 
 				printf("Dados carregados com sucesso!\n");
 #pragma endregion
@@ -183,6 +234,11 @@ int main()
 				cleanOperations(&operations);
 				cleanExecutions_Table(&executionsTable);
 				// FALTA WORK PLANS ?
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+
+				// os dados em memria deixam de corresponder aos ficheiros
+				invalidateJournal(journal);
 
 				printf("Dados removidos com sucesso!\n");
 #pragma endregion
@@ -192,11 +248,8 @@ int main()
 #pragma region opo 5: proposta de escalonamento
 				printf("-> Opo 5. Proposta de escalonamento\n");
 
-				// carregar todos os dados das execues para uma lista
-				Execution* executions = readExecutions_AtList_Binary(EXECUTIONS_FILENAME_TEXT);
-
-				// obter todos os planos de trabalhos necessrios para realizar um plano de produo
-				WorkPlan* workPlans = getAllWorkPlans(jobs, operations, executions);
+				// obter todos os planos de trabalhos necessrios para realizar um plano de produo (com os agregados da tabela hash)
+				WorkPlan* workPlans = getAllWorkPlans(jobs, operations, executionsTable);
 
 				int fullTime = getFullTimeOfPlan(workPlans);
 				printf("Tempo total do plano  %d!\n", fullTime);
@@ -249,6 +302,7 @@ int main()
 				}
 
 				machines = insertMachine_AtStart(machines, machine);
+				appendRecord_AtJournal(journal, JOURNAL_SET_MACHINE, machine->id, 0, 0, machine->name);
 				printf("Mquina adicionada com sucesso!\n");
 #pragma endregion
 				break;
@@ -282,6 +336,8 @@ int main()
 					break;
 				}
 
+				appendRecord_AtJournal(journal, JOURNAL_SET_MACHINE, machineIdToUpdate, 0, 0, updatedMachineName);
+
 				printf("Mquina atualizada com sucesso!\n");
 #pragma endregion
 				break;
@@ -311,7 +367,28 @@ int main()
 
 				// remover todas as execues de operaes associadas  mquina
 				deleteExecutions_ByMachine_AtTable(executionsTable, machineIdToDelete);
+				appendRecord_AtJournal(journal, JOURNAL_DELETE_MACHINE, machineIdToDelete, 0, 0, NULL);
 				printf("Execues de operaes associadas  mquina removidas com sucesso!\n");
+
+				// reparar o plano atual, reatribuindo apenas as operaes da mquina removida
+				if (currentSchedule != NULL)
+				{
+					int failureTime;
+					printf("Introduza o instante da avaria (0 para reatribuir todas as operaes da mquina): ");
+					scanf("%d", &failureTime);
+
+					if (repairSchedule_MachineRemoval(currentInstance, currentSchedule, machineIdToDelete, failureTime) < 0)
+					{
+						printf("No foi possvel reparar o plano atual,  necessrio escalonar de novo.\n");
+						cleanSchedule(&currentSchedule);
+						cleanInstance(&currentInstance);
+						break;
+					}
+
+					exportSchedule(planExporter, currentInstance, currentSchedule);
+
+					printf("Plano reparado com tempo total %d e exportado com sucesso!\n", currentSchedule->makespan);
+				}
 #pragma endregion
 				break;
 
@@ -341,6 +418,7 @@ int main()
 				}
 
 				jobs = insertJob_AtStart(jobs, job);
+				appendRecord_AtJournal(journal, JOURNAL_SET_JOB, job->id, 0, 0, job->name);
 				printf("Tarefa adicionada com sucesso!\n");
 #pragma endregion
 				break;
@@ -374,6 +452,8 @@ int main()
 					break;
 				}
 
+				appendRecord_AtJournal(journal, JOURNAL_SET_JOB, jobIdToUpdate, 0, 0, updatedJobName);
+
 				printf("Tarefa atualizada com sucesso!\n");
 #pragma endregion
 				break;
@@ -414,8 +494,19 @@ int main()
 					deleteExecutions_ByOperation_AtTable(&executionsTable, operationDeletedID);
 				} while (operationDeletedID != -1);
 
+				// a remoo das operaes e das execues da tarefa  repetida ao repor o registo
+				appendRecord_AtJournal(journal, JOURNAL_DELETE_JOB, jobIdToDelete, 0, 0, NULL);
+
 				printf("Operaes associadas  tarefa removidas com sucesso!\n");
 				printf("Execues de Operaes associadas  operao removidas com sucesso!\n");
+
+				// o plano atual deixa de corresponder aos dados
+				if (currentSchedule != NULL)
+				{
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					printf("O plano atual foi descartado,  necessrio escalonar de novo.\n");
+				}
 #pragma endregion
 				break;
 
@@ -486,8 +577,17 @@ int main()
 					break;
 				}
 
+				appendRecord_AtJournal(journal, JOURNAL_SET_OPERATION, operation->operationID, operation->jobID, operation->position, operation->name);
 				printf("Operao adicionada com sucesso!\n");
 
+				// o plano atual deixa de corresponder aos dados
+				if (currentSchedule != NULL)
+				{
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					printf("O plano atual foi descartado,  necessrio escalonar de novo.\n");
+				}
+
 				Execution* execution = newExecution(operation->operationID, machineIdToInsertOperation, runtimeToInsertExecution);
 				if (execution == NULL)
 				{
@@ -497,6 +597,14 @@ int main()
 
 				// inserir nova execuo de uma operao
 				*executionsTable = insertExecution_AtTable(executionsTable, execution);
+				if (searchExecution_AtTable(executionsTable, execution->operationID, execution->machineID) != execution)
+				{
+					printf("No foi possvel adicionar a execuo de operao.\n");
+					cleanExecutions_List(&execution);
+					break;
+				}
+
+				appendRecord_AtJournal(journal, JOURNAL_SET_EXECUTION, execution->operationID, execution->machineID, execution->runtime, NULL);
 				printf("Execuo de operao adicionada com sucesso!\n");
 #pragma endregion
 				break;
@@ -530,7 +638,19 @@ int main()
 					break;
 				}
 
+				Operation* renamedOperation = getOperation(operations, operationIdToUpdate);
+				appendRecord_AtJournal(journal, JOURNAL_SET_OPERATION, renamedOperation->operationID, renamedOperation->jobID, renamedOperation->position,
+					renamedOperation->name);
+
 				printf("Opereo atualizada com sucesso!\n");
+
+				// o plano atual deixa de corresponder aos dados
+				if (currentSchedule != NULL)
+				{
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					printf("O plano atual foi descartado,  necessrio escalonar de novo.\n");
+				}
 #pragma endregion
 				break;
 
@@ -562,7 +682,29 @@ int main()
 					break;
 				}
 
+				appendRecord_AtJournal(journal, JOURNAL_SET_EXECUTION, operationIdToUpdateRuntime, machineIdToUpdateRuntime, runtimeToUpdateRuntime, NULL);
 				printf("Execuo de opereo atualizada com sucesso!\n");
+
+				// reparar o plano atual sem voltar a escalonar todas as operaes
+				if (currentSchedule != NULL)
+				{
+					int polishRepairedPlan;
+					printf("Polir a parte afetada do plano (1 - sim, 0 - no): ");
+					scanf("%d", &polishRepairedPlan);
+
+					if (repairSchedule_Runtime(currentInstance, currentSchedule, operationIdToUpdateRuntime, machineIdToUpdateRuntime, runtimeToUpdateRuntime,
+						polishRepairedPlan ? true : false) < 0)
+					{
+						printf("No foi possvel reparar o plano atual,  necessrio escalonar de novo.\n");
+						cleanSchedule(&currentSchedule);
+						cleanInstance(&currentInstance);
+						break;
+					}
+
+					exportSchedule(planExporter, currentInstance, currentSchedule);
+
+					printf("Plano reparado com tempo total %d e exportado com sucesso!\n", currentSchedule->makespan);
+				}
 #pragma endregion
 				break;
 
@@ -595,7 +737,23 @@ int main()
 					break;
 				}
 
+				// registar as novas posies das 2 operaes
+				Operation* firstSwappedOperation = getOperation(operations, operation1IdToUpdate);
+				Operation* secondSwappedOperation = getOperation(operations, operation2IdToUpdate);
+				appendRecord_AtJournal(journal, JOURNAL_SET_OPERATION, firstSwappedOperation->operationID, firstSwappedOperation->jobID, firstSwappedOperation->position,
+					firstSwappedOperation->name);
+				appendRecord_AtJournal(journal, JOURNAL_SET_OPERATION, secondSwappedOperation->operationID, secondSwappedOperation->jobID, secondSwappedOperation->position,
+					secondSwappedOperation->name);
+
 				printf("Ordem das operaes trocadas com sucesso!\n");
+
+				// o plano atual deixa de corresponder aos dados
+				if (currentSchedule != NULL)
+				{
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					printf("O plano atual foi descartado,  necessrio escalonar de novo.\n");
+				}
 #pragma endregion
 				break;
 
@@ -621,8 +779,18 @@ int main()
 					break;
 				}
 
+				// a remoo das execues da operao  repetida ao repor o registo
+				appendRecord_AtJournal(journal, JOURNAL_DELETE_OPERATION, operationIdToDelete, 0, 0, NULL);
 				printf("Operao removida com sucesso!\n");
 
+				// o plano atual deixa de corresponder aos dados
+				if (currentSchedule != NULL)
+				{
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					printf("O plano atual foi descartado,  necessrio escalonar de novo.\n");
+				}
+
 				// remover execues de operaes associadas  operao
 				if (!deleteExecutions_ByOperation_AtTable(&executionsTable, operationIdToDelete))
 				{
@@ -638,11 +806,17 @@ int main()
 #pragma region opo 17: guardar dados
 				printf("-> Opo 17. Guardar dados\n");
 
-				// guardar os dados em ficheiros .csv
-				writeJobs_Text(JOBS_FILENAME_TEXT, jobs);
-				writeMachines_Text(MACHINES_FILENAME_TEXT, machines);
-				writeOperations_Text(OPERATIONS_FILENAME_TEXT, operations);
-				writeExecutions_AtTable_Text(EXECUTIONS_FILENAME_TEXT, executionsTable);
+				// guardar as alteraes no dirio (os ficheiros .csv e a instncia binria, carregada rapidamente na opo 30,
+				// com dados alterados so reescritos em segundo plano quando o dirio fica grande), ou diretamente nos ficheiros
+				// se no foi possvel abrir o dirio
+				bool saved = journal != NULL ? saveJournal(journal, jobs, machines, operations, executionsTable)
+					: writeData_Changed(jobs, machines, operations, executionsTable, &dirtyData);
+
+				if (!saved)
+				{
+					printf("No foi possvel guardar os dados.\n");
+					break;
+				}
 
 				// guardar os dados em ficheiros binrios
 				//writeJobs_Binary(JOBS_FILENAME_BINARY, jobs);
@@ -664,6 +838,573 @@ int main()
 #pragma endregion
 				break;
 
+			case 19:
+#pragma region opo 19: proposta de escalonamento otimizada (iterated greedy)
+				printf("-> Opo 19. Proposta de escalonamento otimizada (iterated greedy)\n");
+
+				// construir instncia compacta a partir das listas e da tabela hash
+				Instance* instance = newInstance(jobs, machines, operations, executionsTable);
+				if (instance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* schedule = newSchedule(instance);
+				if (schedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&instance);
+					break;
+				}
+
+				// plano inicial pela regra gulosa e melhoria por iterated greedy
+				printf("Tempo total do plano inicial  %d!\n", buildSchedule_Greedy(instance, schedule));
+
+				solveSchedule_IteratedGreedy(instance, schedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE,
+					ITERATED_GREEDY_TIME_LIMIT, 0, (unsigned long long)time(NULL));
+				printf("Tempo total do plano otimizado  %d!\n", schedule->makespan);
+
+				// exportar plano para ficheiro .csv
+				exportSchedule(planExporter, instance, schedule);
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = instance;
+				currentSchedule = schedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 20:
+#pragma region opo 20: proposta de escalonamento com tempo limite
+				printf("-> Opo 20. Proposta de escalonamento com tempo limite\n");
+
+				int timeLimit;
+				printf("Introduza o tempo limite (em milissegundos): ");
+				scanf("%d", &timeLimit);
+
+				Instance* anytimeInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (anytimeInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* anytimeSchedule = newSchedule(anytimeInstance);
+				if (anytimeSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&anytimeInstance);
+					break;
+				}
+
+				// cada plano melhor  exportado para o ficheiro .csv assim que  encontrado
+				solveSchedule_Anytime(anytimeInstance, anytimeSchedule, getCurrentTime() + timeLimit, exportIncumbent, planExporter,
+					(unsigned long long)time(NULL));
+				printf("Tempo total do melhor plano  %d!\n", anytimeSchedule->makespan);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = anytimeInstance;
+				currentSchedule = anytimeSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 21:
+#pragma region opo 21: proposta de escalonamento em paralelo (portflio de algoritmos)
+				printf("-> Opo 21. Proposta de escalonamento em paralelo (portflio de algoritmos)\n");
+
+				int portfolioTimeLimit;
+				printf("Introduza o tempo limite (em milissegundos): ");
+				scanf("%d", &portfolioTimeLimit);
+
+				int numberOfThreads;
+				printf("Introduza a quantidade de threads (0 para usar todos os processadores): ");
+				scanf("%d", &numberOfThreads);
+
+				Instance* portfolioInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (portfolioInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* portfolioSchedule = newSchedule(portfolioInstance);
+				if (portfolioSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&portfolioInstance);
+					break;
+				}
+
+				DecodeStatistics decodeStatistics = { 0 };
+				solveSchedule_Portfolio(portfolioInstance, portfolioSchedule, numberOfThreads, getCurrentTime() + portfolioTimeLimit, exportIncumbent,
+					planExporter, (unsigned long long)time(NULL), &decodeStatistics);
+				printf("Tempo total do melhor plano  %d!\n", portfolioSchedule->makespan);
+
+				// construes aleatorizadas abandonadas pelo limite e trabalho poupado
+				if (decodeStatistics.decodes > 0)
+				{
+					printf("Construes aleatorizadas: %lld, abandonadas: %lld (%.1f%%), operaes poupadas: %.1f%%\n", decodeStatistics.decodes,
+						decodeStatistics.aborted, 100.0 * decodeStatistics.aborted / decodeStatistics.decodes,
+						100.0 * (decodeStatistics.operations - decodeStatistics.scheduled) / decodeStatistics.operations);
+
+					printf("Abandonadas por profundidade (dcimos das operaes escalonadas):");
+					for (int d = 0; d < DECODE_DEPTH_BUCKETS; d++)
+					{
+						printf(" %lld", decodeStatistics.abortedAtDepth[d]);
+					}
+					printf("\n");
+				}
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = portfolioInstance;
+				currentSchedule = portfolioSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 22:
+#pragma region opo 22: proposta de escalonamento em paralelo reprodutvel
+				printf("-> Opo 22. Proposta de escalonamento em paralelo reprodutvel\n");
+
+				unsigned long long deterministicSeed;
+				printf("Introduza a semente: ");
+				scanf("%llu", &deterministicSeed);
+
+				int deterministicThreads;
+				printf("Introduza a quantidade de threads: ");
+				scanf("%d", &deterministicThreads);
+
+				int numberOfEpochs;
+				printf("Introduza a quantidade de pocas (cada poca tem %d iteraes por thread): ", DETERMINISTIC_ITERATIONS_PER_EPOCH);
+				scanf("%d", &numberOfEpochs);
+
+				Instance* deterministicInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (deterministicInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* deterministicSchedule = newSchedule(deterministicInstance);
+				if (deterministicSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&deterministicInstance);
+					break;
+				}
+
+				if (solveSchedule_Deterministic(deterministicInstance, deterministicSchedule, deterministicThreads, numberOfEpochs,
+					DETERMINISTIC_ITERATIONS_PER_EPOCH, 0, exportIncumbent, planExporter, deterministicSeed) < 0)
+				{
+					printf("No foi possvel escalonar.\n");
+				}
+				else
+				{
+					printf("Tempo total do melhor plano  %d!\n", deterministicSchedule->makespan);
+					printf("Plano escalonado e exportado com sucesso!\n");
+
+					// guardar como plano atual, para ser reparado quando os dados mudarem
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					currentInstance = deterministicInstance;
+					currentSchedule = deterministicSchedule;
+					break;
+				}
+
+				cleanSchedule(&deterministicSchedule);
+				cleanInstance(&deterministicInstance);
+#pragma endregion
+				break;
+
+			case 23:
+#pragma region opo 23: inserir novos trabalhos no plano atual (escalonamento online)
+				printf("-> Opo 23. Inserir novos trabalhos no plano atual (escalonamento online)\n");
+
+				if (currentSchedule == NULL)
+				{
+					printf("No existe um plano atual, escolha primeiro uma proposta de escalonamento.\n");
+					break;
+				}
+
+				// cada trabalho lido  inserido e o plano  exportado logo a seguir
+				OnlineScheduler* online = startOnlineScheduler(currentInstance, currentSchedule, exportIncumbent, planExporter);
+				if (online == NULL)
+				{
+					printf("No foi possvel iniciar o escalonamento online.\n");
+					break;
+				}
+
+				int numberOfArrivals = readArrivals_Online(online, ARRIVALS_FILENAME_TEXT);
+				cleanOnlineScheduler(&online);
+
+				if (numberOfArrivals < 0)
+				{
+					printf("No foi possvel ler os novos trabalhos.\n");
+					break;
+				}
+
+				printf("%d novos trabalhos inseridos no plano, com tempo total %d!\n", numberOfArrivals, currentSchedule->makespan);
+#pragma endregion
+				break;
+
+			case 24:
+#pragma region opo 24: proposta de escalonamento por horizonte deslizante
+				printf("-> Opo 24. Proposta de escalonamento por horizonte deslizante (instncias grandes)\n");
+
+				Instance* horizonInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (horizonInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* horizonSchedule = newSchedule(horizonInstance);
+				if (horizonSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&horizonInstance);
+					break;
+				}
+
+				if (solveSchedule_RollingHorizon(horizonInstance, horizonSchedule, ROLLING_HORIZON_WINDOW_SIZE, ROLLING_HORIZON_OVERLAP, ENGINE_ITERATED_GREEDY,
+					ROLLING_HORIZON_ITERATIONS, (unsigned long long)time(NULL), exportIncumbent, planExporter) < 0)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanSchedule(&horizonSchedule);
+					cleanInstance(&horizonInstance);
+					break;
+				}
+
+				printf("Tempo total do plano  %d!\n", horizonSchedule->makespan);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = horizonInstance;
+				currentSchedule = horizonSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 25:
+#pragma region opo 25: proposta de escalonamento por shifting bottleneck
+				printf("-> Opo 25. Proposta de escalonamento por shifting bottleneck (determinstica)\n");
+
+				Instance* bottleneckInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (bottleneckInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* bottleneckSchedule = newSchedule(bottleneckInstance);
+				if (bottleneckSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&bottleneckInstance);
+					break;
+				}
+
+				// atribuio de mquinas com equilbrio de carga e sequncias pelo shifting bottleneck
+				if (solveSchedule_ShiftingBottleneck(bottleneckInstance, bottleneckSchedule) < 0)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanSchedule(&bottleneckSchedule);
+					cleanInstance(&bottleneckInstance);
+					break;
+				}
+
+				printf("Tempo total do plano  %d!\n", bottleneckSchedule->makespan);
+
+				// exportar plano para ficheiro .csv
+				exportSchedule(planExporter, bottleneckInstance, bottleneckSchedule);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = bottleneckInstance;
+				currentSchedule = bottleneckSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 26:
+#pragma region opo 26: propostas de escalonamento multiobjetivo
+				printf("-> Opo 26. Propostas de escalonamento multiobjetivo (frente de Pareto)\n");
+
+				Instance* paretoInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (paretoInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				ParetoArchive* archive = newParetoArchive(paretoInstance, PARETO_ARCHIVE_SIZE);
+				if (archive == NULL || solveSchedule_Pareto(paretoInstance, archive, PARETO_POPULATION_SIZE, PARETO_GENERATIONS, (unsigned long long)time(NULL)) <= 0)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanParetoArchive(&archive);
+					cleanInstance(&paretoInstance);
+					break;
+				}
+
+				// cada plano da frente troca tempo total por carga total e maior carga de uma mquina
+				for (int i = 0; i < archive->size; i++)
+				{
+					int* planObjectives = archive->objectives + i * NUMBER_OF_OBJECTIVES;
+					printf("   %d -> tempo total %d, carga total %d, maior carga %d\n", i + 1, planObjectives[0], planObjectives[1], planObjectives[2]);
+				}
+
+				int chosenPlan;
+				printf("Introduza o plano a exportar: ");
+				scanf("%d", &chosenPlan);
+
+				if (chosenPlan < 1 || chosenPlan > archive->size)
+				{
+					printf("Plano invlido.\n");
+					cleanParetoArchive(&archive);
+					cleanInstance(&paretoInstance);
+					break;
+				}
+
+				// exportar plano para ficheiro .csv
+				exportSchedule(planExporter, paretoInstance, archive->plans[chosenPlan - 1]);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				Schedule* paretoSchedule = newSchedule(paretoInstance);
+				if (paretoSchedule != NULL)
+				{
+					copySchedule(paretoSchedule, archive->plans[chosenPlan - 1]);
+					cleanSchedule(&currentSchedule);
+					cleanInstance(&currentInstance);
+					currentInstance = paretoInstance;
+					currentSchedule = paretoSchedule;
+				}
+				else
+				{
+					cleanInstance(&paretoInstance);
+				}
+
+				cleanParetoArchive(&archive);
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 27:
+#pragma region opo 27: proposta de escalonamento por algoritmo memtico
+				printf("-> Opo 27. Proposta de escalonamento por algoritmo memtico\n");
+
+				int memeticThreads;
+				printf("Introduza a quantidade de threads (0 para usar todos os processadores): ");
+				scanf("%d", &memeticThreads);
+
+				Instance* memeticInstance = newInstance(jobs, machines, operations, executionsTable);
+				if (memeticInstance == NULL)
+				{
+					printf("No existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				Schedule* memeticSchedule = newSchedule(memeticInstance);
+				if (memeticSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&memeticInstance);
+					break;
+				}
+
+				// o melhor plano de cada gerao  exportado assim que  encontrado
+				if (solveSchedule_Memetic(memeticInstance, memeticSchedule, MEMETIC_POPULATION_SIZE, MEMETIC_GENERATIONS, memeticThreads, 0, exportIncumbent,
+					planExporter, (unsigned long long)time(NULL)) < 0)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanSchedule(&memeticSchedule);
+					cleanInstance(&memeticInstance);
+					break;
+				}
+
+				printf("Tempo total do melhor plano  %d!\n", memeticSchedule->makespan);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = memeticInstance;
+				currentSchedule = memeticSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 28:
+#pragma region opo 28: proposta de escalonamento carregando a instncia diretamente dos ficheiros
+				printf("-> Opo 28. Proposta de escalonamento carregando a instncia diretamente dos ficheiros\n");
+
+				// os ficheiros .csv so mapeados em memria e lidos sem criar as listas nem a tabela hash
+				long long loadStart = getCurrentTime();
+				Instance* fileInstance = readInstance_Text(JOBS_FILENAME_TEXT, MACHINES_FILENAME_TEXT, OPERATIONS_FILENAME_TEXT, EXECUTIONS_FILENAME_TEXT);
+				if (fileInstance == NULL)
+				{
+					printf("No foi possvel carregar os ficheiros ou no existem dados suficientes para escalonar.\n");
+					break;
+				}
+
+				printf("Instncia com %d operaes e %d execues carregada em %lld ms.\n", fileInstance->numberOfOperations, fileInstance->numberOfExecutions,
+					getCurrentTime() - loadStart);
+
+				Schedule* fileSchedule = newSchedule(fileInstance);
+				if (fileSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&fileInstance);
+					break;
+				}
+
+				// plano inicial pela regra gulosa e melhoria por iterated greedy
+				printf("Tempo total do plano inicial  %d!\n", buildSchedule_Greedy(fileInstance, fileSchedule));
+
+				solveSchedule_IteratedGreedy(fileInstance, fileSchedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE,
+					ITERATED_GREEDY_TIME_LIMIT, 0, (unsigned long long)time(NULL));
+				printf("Tempo total do plano otimizado  %d!\n", fileSchedule->makespan);
+
+				exportSchedule(planExporter, fileInstance, fileSchedule);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = fileInstance;
+				currentSchedule = fileSchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 29:
+#pragma region opo 29: proposta de escalonamento para uma instncia de benchmark (.fjs)
+				printf("-> Opo 29. Proposta de escalonamento para uma instncia de benchmark (.fjs)\n");
+
+				fseek(stdin, 0, SEEK_END);
+
+				char benchmarkFileName[FILE_LINE_SIZE];
+				printf("Introduza o caminho do ficheiro .fjs: ");
+				fgets(benchmarkFileName, sizeof(benchmarkFileName), stdin);
+
+				removeNewLine(benchmarkFileName); // remover a nova linha do final da string
+
+				long long benchmarkStart = getCurrentTime();
+				Instance* benchmarkInstance = readInstance_Benchmark(benchmarkFileName);
+				if (benchmarkInstance == NULL)
+				{
+					printf("No foi possvel carregar o ficheiro.\n");
+					break;
+				}
+
+				printf("Instncia com %d trabalhos, %d mquinas e %d operaes carregada em %lld ms.\n", benchmarkInstance->numberOfJobs,
+					benchmarkInstance->numberOfMachines, benchmarkInstance->numberOfOperations, getCurrentTime() - benchmarkStart);
+
+				Schedule* benchmarkSchedule = newSchedule(benchmarkInstance);
+				if (benchmarkSchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&benchmarkInstance);
+					break;
+				}
+
+				printf("Tempo total do plano inicial  %d!\n", buildSchedule_Greedy(benchmarkInstance, benchmarkSchedule));
+
+				solveSchedule_IteratedGreedy(benchmarkInstance, benchmarkSchedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE,
+					ITERATED_GREEDY_TIME_LIMIT, 0, (unsigned long long)time(NULL));
+				printf("Tempo total do plano otimizado  %d!\n", benchmarkSchedule->makespan);
+
+				// o plano no substitui o plano atual, porque a instncia no corresponde aos dados carregados
+				cleanSchedule(&benchmarkSchedule);
+				cleanInstance(&benchmarkInstance);
+#pragma endregion
+				break;
+
+			case 30:
+#pragma region opo 30: proposta de escalonamento carregando a instncia guardada em binrio
+				printf("-> Opo 30. Proposta de escalonamento carregando a instncia guardada em binrio\n");
+
+				// o ficheiro  reescrito em segundo plano quando os dados guardados na opo 17 so compactados
+				long long snapshotStart = getCurrentTime();
+				Instance* binaryInstance = readInstance_Binary(INSTANCE_FILENAME_BINARY);
+				if (binaryInstance == NULL)
+				{
+					printf("No foi possvel carregar o ficheiro (no existe,  de outra verso ou est corrompido).\n");
+					break;
+				}
+
+				printf("Instncia com %d operaes e %d execues carregada em %lld ms.\n", binaryInstance->numberOfOperations, binaryInstance->numberOfExecutions,
+					getCurrentTime() - snapshotStart);
+
+				Schedule* binarySchedule = newSchedule(binaryInstance);
+				if (binarySchedule == NULL)
+				{
+					printf("No foi possvel escalonar.\n");
+					cleanInstance(&binaryInstance);
+					break;
+				}
+
+				// plano inicial pela regra gulosa e melhoria por iterated greedy
+				printf("Tempo total do plano inicial  %d!\n", buildSchedule_Greedy(binaryInstance, binarySchedule));
+
+				solveSchedule_IteratedGreedy(binaryInstance, binarySchedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE,
+					ITERATED_GREEDY_TIME_LIMIT, 0, (unsigned long long)time(NULL));
+				printf("Tempo total do plano otimizado  %d!\n", binarySchedule->makespan);
+
+				exportSchedule(planExporter, binaryInstance, binarySchedule);
+
+				// guardar como plano atual, para ser reparado quando os dados mudarem
+				cleanSchedule(&currentSchedule);
+				cleanInstance(&currentInstance);
+				currentInstance = binaryInstance;
+				currentSchedule = binarySchedule;
+
+				printf("Plano escalonado e exportado com sucesso!\n");
+#pragma endregion
+				break;
+
+			case 31:
+#pragma region opo 31: escolher o formato de exportao dos planos
+				printf("-> Opo 31. Escolher o formato de exportao dos planos\n");
+
+				int planFormat = 0;
+				printf("Formato (0 - CSV, 1 - JSON lines, 2 - binrio): ");
+				if (!scanf("%d", &planFormat) || planFormat < 0 || planFormat >= NUMBER_OF_PLAN_FORMATS)
+				{
+					printf("Formato invlido.\n");
+					break;
+				}
+
+				char* planFileNames[NUMBER_OF_PLAN_FORMATS] = { PLAN_FILENAME_TEXT, PLAN_FILENAME_JSON, PLAN_FILENAME_BINARY };
+
+				PlanExporter* newExporter = newPlanExporter(planFileNames[planFormat], (PlanFormat)planFormat);
+				if (newExporter == NULL)
+				{
+					printf("No foi possvel alterar o formato.\n");
+					break;
+				}
+
+				cleanPlanExporter(&planExporter);
+				planExporter = newExporter;
+
+				printf("Os planos passam a ser exportados para o ficheiro %s.\n", planExporter->fileName);
+#pragma endregion
+				break;
+
 			default:
 				printf("Opo invlida. Tente novamente.\n");
 				break;
@@ -679,6 +1420,10 @@ int main()
 	cleanOperations(&operations);
 	cleanExecutions_Table(&executionsTable);
 	// FALTA WORK PLANS ?
+	cleanSchedule(&currentSchedule);
+	cleanInstance(&currentInstance);
+	cleanPlanExporter(&planExporter);
+	closeJournal(&journal);
 
 	return true;
 }
\ No newline at end of file
@@ -0,0 +1,445 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao escalonamento por algoritmo memtico (algoritmo gentico com procura local nos descendentes).
+ * @file	memetic.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Indivduo da populao: cromossoma e avaliao
+*/
+typedef struct Individual
+{
+	int* assignment; // posio (em eligibleMachines) da mquina de cada operao
+	int* sequence; // ndices dos trabalhos, cada um repetido tantas vezes quantas as suas operaes
+	int makespan;
+	unsigned long long fingerprint;
+	bool improvedLate; // se a procura local ainda melhorou o descendente no ltimo quarto dos movimentos
+	bool improvedEarly; // se a procura local deixou de melhorar o descendente no primeiro quarto dos movimentos
+} Individual;
+
+
+/**
+ * @brief	Dados de cada thread: gera, constri e melhora os descendentes de um intervalo da populao
+*/
+typedef struct MemeticWorker
+{
+	Instance* instance;
+	Individual* population; // progenitores nas primeiras populationSize posies, descendentes a seguir
+	int populationSize;
+	int first; // primeiro descendente da thread
+	int last; // descendente seguinte ao ltimo da thread
+	int budget; // quantidade mxima de movimentos da procura local de cada descendente
+	int generation;
+	unsigned long long seed;
+	Schedule* schedule;
+	Schedule* backup;
+	int* tails;
+	int* critical;
+	bool* keepJob;
+	bool success;
+} MemeticWorker;
+
+
+/**
+ * @brief	Escolher um indivduo por torneio binrio (menor tempo total)
+*/
+static int selectByTournament(Individual* population, int populationSize, Random* random)
+{
+	int first = nextRandom_Int(random, populationSize);
+	int second = nextRandom_Int(random, populationSize);
+
+	return population[first].makespan <= population[second].makespan ? first : second;
+}
+
+
+/**
+ * @brief	Procura local no caminho crtico com um limite de movimentos
+ *
+ * Em cada movimento  escolhida uma operao crtica aleatria (incio + cauda igual ao tempo total). Se a seguinte na mquina
+ * tambm for crtica e comear quando ela termina, as duas so trocadas; caso contrrio, a operao  reinserida na melhor
+ * posio de qualquer mquina elegvel. O movimento  mantido se no piorar o plano.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano completo e avaliado ( melhorado)
+ * @param	backup		Memria auxiliar para desfazer movimentos
+ * @param	tails		Memria auxiliar (tamanho igual  quantidade de operaes)
+ * @param	critical	Memria auxiliar (tamanho igual  quantidade de operaes)
+ * @param	budget		Quantidade mxima de movimentos
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+ * @return	ndice do ltimo movimento que melhorou o plano (ou -1 se nenhum melhorou)
+*/
+static int improveOffspring(Instance* instance, Schedule* schedule, Schedule* backup, int* tails, int* critical, int budget, Random* random)
+{
+	int lastImprovement = -1;
+
+	for (int move = 0; move < budget; move++)
+	{
+		getTails_OfSchedule(schedule, tails);
+
+		int count = 0;
+		for (int o = 0; o < instance->numberOfOperations; o++)
+		{
+			if (schedule->startTime[o] + tails[o] == schedule->makespan)
+			{
+				critical[count++] = o;
+			}
+		}
+
+		if (count == 0)
+		{
+			break;
+		}
+
+		int o = critical[nextRandom_Int(random, count)];
+		int next = schedule->nextInMachine[o];
+		int machine = schedule->assignedMachine[o];
+		int makespan = schedule->makespan;
+		int cost;
+
+		copySchedule(backup, schedule);
+
+		if (next != -1 && schedule->startTime[next] == schedule->endTime[o] && schedule->startTime[next] + tails[next] == makespan)
+		{
+			// trocar a operao com a seguinte no bloco crtico da mquina
+			int runtime = schedule->assignedRuntime[o];
+
+			removeOperation_AtSchedule(schedule, o);
+			insertOperation_AtSchedule(schedule, o, machine, runtime, next);
+			cost = evaluateSchedule(instance, schedule);
+		}
+		else
+		{
+			removeOperation_AtSchedule(schedule, o);
+			cost = reinsertOperation_AtBestPosition(instance, schedule, o, 0, tails);
+		}
+
+		if (cost < 0 || cost > makespan)
+		{
+			copySchedule(schedule, backup);
+		}
+		else if (cost < makespan)
+		{
+			lastImprovement = move;
+		}
+	}
+
+	return lastImprovement;
+}
+
+
+/**
+ * @brief	Gerar, construir e melhorar os descendentes de uma thread (a procura local corre na mesma thread que construiu o plano)
+ *
+ * Cada descendente tem o seu prprio gerador, derivado da semente, da gerao e da sua posio, pelo que o resultado
+ * no depende da quantidade de threads nem da ordem em que so executadas.
+ * @param	argument	Dados da thread
+*/
+static void runMemeticWorker(void* argument)
+{
+	MemeticWorker* worker = (MemeticWorker*)argument;
+	Instance* instance = worker->instance;
+	Individual* population = worker->population;
+
+	for (int i = worker->first; i < worker->last && worker->success; i++)
+	{
+		Random random = newRandom(worker->seed + ((unsigned long long)worker->generation * 2 * worker->populationSize + i + 1) * 0x9E3779B97F4A7C15ULL);
+		Individual* child = &population[i];
+
+		int first = selectByTournament(population, worker->populationSize, &random);
+		int second = selectByTournament(population, worker->populationSize, &random);
+
+		crossoverChromosomes(instance, population[first].assignment, population[first].sequence, population[second].assignment, population[second].sequence,
+			child->assignment, child->sequence, worker->keepJob, &random);
+
+		if (nextRandom_Float(&random) < MEMETIC_MUTATION_RATE)
+		{
+			mutateChromosome(instance, child->assignment, child->sequence, &random);
+		}
+
+		int built = buildSchedule_Decoded(instance, worker->schedule, child->assignment, child->sequence, 0, NULL, NULL);
+		worker->success = built >= 0;
+
+		if (worker->success)
+		{
+			// o plano melhorado volta ao cromossoma (aprendizagem lamarckiana)
+			int lastImprovement = improveOffspring(instance, worker->schedule, worker->backup, worker->tails, worker->critical, worker->budget, &random);
+
+			child->makespan = worker->schedule->makespan;
+			child->improvedLate = 4 * (lastImprovement + 1) > 3 * worker->budget;
+			child->improvedEarly = 4 * (lastImprovement + 1) <= worker->budget;
+			child->fingerprint = worker->schedule->fingerprint;
+			worker->success = encodeSchedule(instance, worker->schedule, child->assignment, child->sequence);
+		}
+	}
+}
+
+
+/**
+ * @brief	Ordenar a populao combinada por tempo total e manter nas primeiras posies os melhores planos distintos
+ * @param	population		Populao combinada (progenitores e descendentes)
+ * @param	count			Tamanho da populao combinada
+ * @param	fingerprints	Conjunto auxiliar de impresses digitais (com memria para a populao combinada)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool selectSurvivors(Individual* population, int count, FingerprintSet* fingerprints)
+{
+	Individual* ordered = (Individual*)malloc(count * sizeof(Individual));
+	if (ordered == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	// ordenao por insero estvel (populaes pequenas)
+	for (int i = 0; i < count; i++)
+	{
+		Individual individual = population[i];
+		int j = i;
+
+		while (j > 0 && ordered[j - 1].makespan > individual.makespan)
+		{
+			ordered[j] = ordered[j - 1];
+			j--;
+		}
+
+		ordered[j] = individual;
+	}
+
+	// primeiro os planos distintos, depois os repetidos
+	clearFingerprintSet(fingerprints);
+
+	int front = 0, back = count - 1;
+	for (int i = 0; i < count; i++)
+	{
+		if (insertFingerprint_AtSet(fingerprints, ordered[i].fingerprint))
+		{
+			population[front++] = ordered[i];
+		}
+		else
+		{
+			population[back--] = ordered[i];
+		}
+	}
+
+	// os repetidos ficam pela ordem do tempo total, a seguir aos distintos
+	for (int i = front, j = count - 1; i < j; i++, j--)
+	{
+		Individual swap = population[i];
+		population[i] = population[j];
+		population[j] = swap;
+	}
+
+	free(ordered);
+
+	return true;
+}
+
+
+/**
+ * @brief	Resolver o escalonamento por algoritmo memtico
+ *
+ * Algoritmo gentico sobre cromossomas (atribuio de mquinas e sequncia de trabalhos) em que cada descendente, depois de
+ * construdo,  melhorado por uma procura local curta no caminho crtico, na mesma thread, enquanto os dados esto em cache.
+ * O limite de movimentos da procura local adapta-se  melhoria que produz: duplica quando mais de metade dos descendentes ainda
+ * melhoram no ltimo quarto dos movimentos e cai para metade quando mais de metade deixam de melhorar no primeiro quarto
+ * (entre MEMETIC_MIN_BUDGET e MEMETIC_MAX_BUDGET).
+ * A populao inicial inclui o plano do shifting bottleneck e o da regra gulosa. Os sobreviventes so os melhores planos distintos
+ * (pela impresso digital) entre progenitores e descendentes. Com a mesma semente, o resultado no depende da quantidade de threads.
+ * @param	instance		Instncia do problema
+ * @param	best			Plano onde  guardado o melhor plano encontrado
+ * @param	populationSize	Quantidade de indivduos da populao
+ * @param	generations		Quantidade de geraes
+ * @param	numberOfThreads	Quantidade de threads (0 para usar todos os processadores)
+ * @param	deadline		Instante (de getCurrentTime) a partir do qual no so iniciadas mais geraes (0 para no limitar)
+ * @param	callback		Funo chamada com cada novo melhor plano (ou NULL), que pode devolver false para terminar a procura
+ * @param	context			Dados passados  funo callback
+ * @param	seed			Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_Memetic(Instance* instance, Schedule* best, int populationSize, int generations, int numberOfThreads, long long deadline,
+	IncumbentCallback callback, void* context, unsigned long long seed)
+{
+	if (instance == NULL || best == NULL || populationSize < 2 || instance->numberOfOperations == 0)
+	{
+		return -1;
+	}
+
+	if (numberOfThreads <= 0)
+	{
+		numberOfThreads = getNumberOfProcessors();
+	}
+
+	numberOfThreads = numberOfThreads < populationSize ? numberOfThreads : populationSize;
+
+	int n = instance->numberOfOperations;
+	int count = 2 * populationSize;
+
+	Individual* population = (Individual*)calloc(count, sizeof(Individual));
+	MemeticWorker* workers = (MemeticWorker*)calloc(numberOfThreads, sizeof(MemeticWorker));
+	Thread* threads = (Thread*)malloc(numberOfThreads * sizeof(Thread));
+	bool* started = (bool*)calloc(numberOfThreads, sizeof(bool));
+	FingerprintSet* fingerprints = newFingerprintSet(count);
+
+	bool success = population != NULL && workers != NULL && threads != NULL && started != NULL && fingerprints != NULL;
+
+	for (int i = 0; i < count && success; i++)
+	{
+		population[i].assignment = (int*)malloc(n * sizeof(int));
+		population[i].sequence = (int*)malloc(n * sizeof(int));
+		success = population[i].assignment != NULL && population[i].sequence != NULL;
+	}
+
+	for (int t = 0; t < numberOfThreads && success; t++)
+	{
+		workers[t].instance = instance;
+		workers[t].population = population;
+		workers[t].populationSize = populationSize;
+		workers[t].first = populationSize + t * populationSize / numberOfThreads;
+		workers[t].last = populationSize + (t + 1) * populationSize / numberOfThreads;
+		workers[t].seed = seed;
+		workers[t].success = true;
+		workers[t].schedule = newSchedule(instance);
+		workers[t].backup = newSchedule(instance);
+		workers[t].tails = (int*)malloc(n * sizeof(int));
+		workers[t].critical = (int*)malloc(n * sizeof(int));
+		workers[t].keepJob = (bool*)malloc(instance->numberOfJobs * sizeof(bool));
+
+		success = workers[t].schedule != NULL && workers[t].backup != NULL && workers[t].tails != NULL && workers[t].critical != NULL
+			&& workers[t].keepJob != NULL;
+	}
+
+	// populao inicial: shifting bottleneck, regra gulosa e cromossomas aleatrios
+	Random random = newRandom(seed);
+	Schedule* schedule = success ? workers[0].schedule : NULL;
+
+	for (int i = 0; i < populationSize && success; i++)
+	{
+		Individual* individual = &population[i];
+		int built = -1;
+
+		if (i == 0)
+		{
+			clearSchedule(schedule);
+			built = solveSchedule_ShiftingBottleneck(instance, schedule);
+		}
+		else if (i == 1)
+		{
+			built = buildSchedule_Greedy(instance, schedule);
+		}
+
+		if (built >= 0)
+		{
+			success = encodeSchedule(instance, schedule, individual->assignment, individual->sequence);
+		}
+		else
+		{
+			success = fillChromosome_Random(instance, individual->assignment, individual->sequence, &random)
+				&& buildSchedule_Decoded(instance, schedule, individual->assignment, individual->sequence, 0, NULL, NULL) >= 0;
+		}
+
+		individual->makespan = schedule != NULL ? schedule->makespan : -1;
+		individual->fingerprint = schedule != NULL ? schedule->fingerprint : 0;
+
+		if (success && (i == 0 || individual->makespan < best->makespan))
+		{
+			copySchedule(best, schedule);
+		}
+	}
+
+	if (success && callback != NULL)
+	{
+		success = callback(instance, best, context);
+	}
+
+	int budget = MEMETIC_LOCAL_SEARCH_BUDGET;
+
+	for (int generation = 0; generation < generations && success; generation++)
+	{
+		if (deadline > 0 && getCurrentTime() >= deadline)
+		{
+			break;
+		}
+
+		for (int t = 0; t < numberOfThreads; t++)
+		{
+			workers[t].budget = budget;
+			workers[t].generation = generation;
+			started[t] = startThread(&threads[t], runMemeticWorker, &workers[t]);
+		}
+
+		for (int t = 0; t < numberOfThreads; t++)
+		{
+			if (started[t])
+			{
+				joinThread(threads[t]);
+			}
+			else
+			{
+				runMemeticWorker(&workers[t]); // sem thread, os descendentes so gerados nesta thread com o mesmo resultado
+			}
+
+			success = success && workers[t].success;
+		}
+
+		// adaptar o limite da procura local  melhoria que est a produzir
+		int late = 0, early = 0;
+		for (int i = populationSize; i < count; i++)
+		{
+			late += population[i].improvedLate;
+			early += population[i].improvedEarly;
+		}
+
+		if (2 * late > populationSize)
+		{
+			budget = budget * 2 < MEMETIC_MAX_BUDGET ? budget * 2 : MEMETIC_MAX_BUDGET;
+		}
+		else if (2 * early > populationSize)
+		{
+			budget = budget / 2 > MEMETIC_MIN_BUDGET ? budget / 2 : MEMETIC_MIN_BUDGET;
+		}
+
+		success = success && selectSurvivors(population, count, fingerprints);
+
+		if (success && population[0].makespan < best->makespan)
+		{
+			success = buildSchedule_Decoded(instance, best, population[0].assignment, population[0].sequence, 0, NULL, NULL) >= 0;
+
+			if (success && callback != NULL && !callback(instance, best, context)) // publicar o novo melhor plano
+			{
+				break;
+			}
+		}
+	}
+
+	for (int i = 0; population != NULL && i < count; i++)
+	{
+		free(population[i].assignment);
+		free(population[i].sequence);
+	}
+
+	for (int t = 0; workers != NULL && t < numberOfThreads; t++)
+	{
+		cleanSchedule(&workers[t].schedule);
+		cleanSchedule(&workers[t].backup);
+		free(workers[t].tails);
+		free(workers[t].critical);
+		free(workers[t].keepJob);
+	}
+
+	free(population);
+	free(workers);
+	free(threads);
+	free(started);
+	cleanFingerprintSet(&fingerprints);
+
+	return success || best->numberOfScheduled == instance->numberOfOperations ? best->makespan : -1;
+}
\ No newline at end of file
@@ -0,0 +1,728 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao escalonamento online (novos trabalhos inseridos no plano em curso).
+ * @file	online.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Estado do escalonamento online
+ *
+ * Os intervalos livres de cada mquina esto numa rvore de pesquisa (treap) ordenada pelo tempo inicial do intervalo,
+ * em que cada n guarda tambm o maior comprimento de intervalo da sua sub-rvore. Assim, o primeiro intervalo onde uma
+ * operao cabe  encontrado em tempo logartmico. Os ns so ndices em arrays, como as sequncias do plano.
+*/
+struct OnlineScheduler
+{
+	Instance* instance;
+	Schedule* schedule;
+	IncumbentCallback callback;
+	void* context;
+	Random random; // prioridades dos ns da rvore
+	int* roots; // raiz da rvore de intervalos livres de cada mquina (ou -1)
+	int* gapStart; // tempo inicial de cada intervalo
+	int* gapEnd; // tempo final de cada intervalo (INT_MAX para o intervalo depois da ltima operao)
+	int* gapPrevious; // operao antes do intervalo na mquina (ou -1)
+	int* left;
+	int* right;
+	int* maxLength; // maior comprimento de intervalo da sub-rvore
+	unsigned int* priority;
+	int numberOfGaps; // quantidade de ns usados
+	int capacity;
+	int freeGap; // primeiro n removido que pode ser reutilizado (os seguintes esto ligados por left)
+};
+
+
+#pragma region rvores de intervalos livres
+
+/**
+ * @brief	Criar um n para um intervalo livre
+ * @param	online		Estado do escalonamento online
+ * @param	start		Tempo inicial do intervalo
+ * @param	end			Tempo final do intervalo
+ * @param	previous	Operao antes do intervalo na mquina (ou -1)
+ * @return	ndice do n (ou -1 se no houver memria)
+*/
+static int newGap(OnlineScheduler* online, int start, int end, int previous)
+{
+	int gap = online->freeGap;
+
+	if (gap != -1)
+	{
+		online->freeGap = online->left[gap];
+	}
+	else
+	{
+		if (online->numberOfGaps == online->capacity)
+		{
+			int capacity = online->capacity * 2;
+			int* arrays[] = { NULL, NULL, NULL, NULL, NULL, NULL };
+			int** fields[] = { &online->gapStart, &online->gapEnd, &online->gapPrevious, &online->left, &online->right, &online->maxLength };
+
+			for (int i = 0; i < 6; i++)
+			{
+				arrays[i] = (int*)realloc(*fields[i], capacity * sizeof(int));
+				if (arrays[i] == NULL) // se no houver memria para alocar
+				{
+					return -1;
+				}
+
+				*fields[i] = arrays[i];
+			}
+
+			unsigned int* priority = (unsigned int*)realloc(online->priority, capacity * sizeof(unsigned int));
+			if (priority == NULL)
+			{
+				return -1;
+			}
+
+			online->priority = priority;
+			online->capacity = capacity;
+		}
+
+		gap = online->numberOfGaps++;
+	}
+
+	online->gapStart[gap] = start;
+	online->gapEnd[gap] = end;
+	online->gapPrevious[gap] = previous;
+	online->left[gap] = -1;
+	online->right[gap] = -1;
+	online->maxLength[gap] = end - start;
+	online->priority[gap] = (unsigned int)nextRandom(&online->random);
+
+	return gap;
+}
+
+
+/**
+ * @brief	Atualizar o maior comprimento de intervalo da sub-rvore de um n
+ * @param	online	Estado do escalonamento online
+ * @param	gap		ndice do n
+*/
+static void updateGap(OnlineScheduler* online, int gap)
+{
+	int length = online->gapEnd[gap] - online->gapStart[gap];
+
+	if (online->left[gap] != -1 && online->maxLength[online->left[gap]] > length)
+	{
+		length = online->maxLength[online->left[gap]];
+	}
+
+	if (online->right[gap] != -1 && online->maxLength[online->right[gap]] > length)
+	{
+		length = online->maxLength[online->right[gap]];
+	}
+
+	online->maxLength[gap] = length;
+}
+
+
+/**
+ * @brief	Dividir uma rvore em duas: intervalos que comeam antes de um tempo e os restantes
+ * @param	online	Estado do escalonamento online
+ * @param	root	Raiz da rvore
+ * @param	key		Tempo de diviso
+ * @param	before	Raiz da rvore com os intervalos que comeam antes de key
+ * @param	after	Raiz da rvore com os restantes intervalos
+*/
+static void splitGaps(OnlineScheduler* online, int root, int key, int* before, int* after)
+{
+	if (root == -1)
+	{
+		*before = -1;
+		*after = -1;
+		return;
+	}
+
+	if (online->gapStart[root] < key)
+	{
+		splitGaps(online, online->right[root], key, &online->right[root], after);
+		*before = root;
+	}
+	else
+	{
+		splitGaps(online, online->left[root], key, before, &online->left[root]);
+		*after = root;
+	}
+
+	updateGap(online, root);
+}
+
+
+/**
+ * @brief	Juntar duas rvores, em que todos os intervalos da primeira comeam antes dos da segunda
+ * @param	online	Estado do escalonamento online
+ * @param	first	Raiz da primeira rvore
+ * @param	second	Raiz da segunda rvore
+ * @return	Raiz da rvore resultante
+*/
+static int mergeGaps(OnlineScheduler* online, int first, int second)
+{
+	if (first == -1)
+	{
+		return second;
+	}
+
+	if (second == -1)
+	{
+		return first;
+	}
+
+	if (online->priority[first] > online->priority[second])
+	{
+		online->right[first] = mergeGaps(online, online->right[first], second);
+		updateGap(online, first);
+		return first;
+	}
+
+	online->left[second] = mergeGaps(online, first, online->left[second]);
+	updateGap(online, second);
+	return second;
+}
+
+
+/**
+ * @brief	Inserir um intervalo livre na rvore de uma mquina
+ * @param	online		Estado do escalonamento online
+ * @param	machine		ndice da mquina
+ * @param	start		Tempo inicial do intervalo
+ * @param	end			Tempo final do intervalo
+ * @param	previous	Operao antes do intervalo na mquina (ou -1)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool insertGap(OnlineScheduler* online, int machine, int start, int end, int previous)
+{
+	int gap = newGap(online, start, end, previous);
+	if (gap == -1)
+	{
+		return false;
+	}
+
+	int before, after;
+	splitGaps(online, online->roots[machine], start, &before, &after);
+	online->roots[machine] = mergeGaps(online, mergeGaps(online, before, gap), after);
+
+	return true;
+}
+
+
+/**
+ * @brief	Remover um intervalo livre da rvore de uma mquina
+ * @param	online		Estado do escalonamento online
+ * @param	machine		ndice da mquina
+ * @param	gap			ndice do n
+*/
+static void removeGap(OnlineScheduler* online, int machine, int gap)
+{
+	int before, middle, after;
+
+	splitGaps(online, online->roots[machine], online->gapStart[gap], &before, &middle);
+	splitGaps(online, middle, online->gapStart[gap] + 1, &middle, &after);
+	online->roots[machine] = mergeGaps(online, before, after);
+
+	online->left[gap] = online->freeGap;
+	online->freeGap = gap;
+}
+
+
+/**
+ * @brief	Repor um intervalo livre de uma mquina, juntando de novo os pedaos em que foi dividido
+ *
+ * Como um dos ns libertados  reutilizado, a reposio no precisa de memria.
+ * @param	online		Estado do escalonamento online
+ * @param	machine		ndice da mquina
+ * @param	start		Tempo inicial do intervalo
+ * @param	end			Tempo final do intervalo
+ * @param	previous	Operao antes do intervalo na mquina (ou -1)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool restoreGap(OnlineScheduler* online, int machine, int start, int end, int previous)
+{
+	int before, middle, after;
+
+	splitGaps(online, online->roots[machine], start, &before, &middle);
+	splitGaps(online, middle, end, &middle, &after);
+	online->roots[machine] = mergeGaps(online, before, after);
+
+	// os pedaos que ficaram dentro do intervalo voltam a estar livres
+	while (middle != -1)
+	{
+		int gap = middle;
+		middle = mergeGaps(online, online->left[gap], online->right[gap]);
+
+		online->left[gap] = online->freeGap;
+		online->freeGap = gap;
+	}
+
+	return insertGap(online, machine, start, end, previous);
+}
+
+
+/**
+ * @brief	Procurar o primeiro intervalo de uma sub-rvore que comea depois de um tempo e tem pelo menos um comprimento
+ * @param	online		Estado do escalonamento online
+ * @param	root		Raiz da sub-rvore
+ * @param	ready		Tempo a partir do qual o intervalo tem de comear (exclusive)
+ * @param	runtime		Comprimento mnimo do intervalo
+ * @return	ndice do n (ou -1 se no existir)
+*/
+static int findFirstGap(OnlineScheduler* online, int root, int ready, int runtime)
+{
+	if (root == -1 || online->maxLength[root] < runtime)
+	{
+		return -1;
+	}
+
+	if (online->gapStart[root] <= ready)
+	{
+		return findFirstGap(online, online->right[root], ready, runtime);
+	}
+
+	int found = findFirstGap(online, online->left[root], ready, runtime);
+	if (found != -1)
+	{
+		return found;
+	}
+
+	if (online->gapEnd[root] - online->gapStart[root] >= runtime)
+	{
+		return root;
+	}
+
+	return findFirstGap(online, online->right[root], ready, runtime);
+}
+
+
+/**
+ * @brief	Procurar o intervalo livre de uma mquina onde uma operao pode comear mais cedo
+ * @param	online		Estado do escalonamento online
+ * @param	machine		ndice da mquina
+ * @param	ready		Tempo a partir do qual a operao pode comear
+ * @param	runtime		Tempo de execuo da operao
+ * @param	start		Tempo inicial da operao nesse intervalo
+ * @return	ndice do n (ou -1 se no existir)
+*/
+static int findGap(OnlineScheduler* online, int machine, int ready, int runtime, int* start)
+{
+	// intervalo que contm o tempo ready (o ltimo que comea at ready)
+	int containing = -1;
+	for (int gap = online->roots[machine]; gap != -1; )
+	{
+		if (online->gapStart[gap] <= ready)
+		{
+			containing = gap;
+			gap = online->right[gap];
+		}
+		else
+		{
+			gap = online->left[gap];
+		}
+	}
+
+	if (containing != -1 && ready + runtime <= online->gapEnd[containing])
+	{
+		*start = ready;
+		return containing;
+	}
+
+	int gap = findFirstGap(online, online->roots[machine], ready, runtime);
+	if (gap != -1)
+	{
+		*start = online->gapStart[gap];
+	}
+
+	return gap;
+}
+
+#pragma endregion
+
+
+#pragma region escalonamento online
+
+/**
+ * @brief	Desfazer a insero de parte de um trabalho, ficando o plano, os intervalos livres e a instncia como estavam
+ * @param	online		Estado do escalonamento online
+ * @param	job			ndice do trabalho acrescentado  instncia
+ * @param	used		Intervalo usado por cada operao j colocada (4 valores cada: mquina, tempo inicial, tempo final e operao anterior)
+ * @param	count		Quantidade de operaes j colocadas
+ * @param	makespan	Tempo total do plano antes da insero
+*/
+static void undoJob_Online(OnlineScheduler* online, int job, int* used, int count, int makespan)
+{
+	Instance* instance = online->instance;
+	Schedule* schedule = online->schedule;
+	int first = instance->jobStart[job];
+
+	// pela ordem inversa, para que cada intervalo esteja como ficou depois de a sua operao ser colocada
+	for (int i = count - 1; i >= 0; i--)
+	{
+		removeOperation_AtSchedule(schedule, first + i);
+		restoreGap(online, used[4 * i], used[4 * i + 1], used[4 * i + 2], used[4 * i + 3]);
+	}
+
+	schedule->numberOfOperations = first;
+	schedule->makespan = makespan;
+
+	instance->numberOfJobs = job;
+	instance->numberOfOperations = first;
+	instance->numberOfExecutions = instance->eligibleStart[first];
+}
+
+
+/**
+ * @brief	Iniciar o escalonamento online sobre um plano em curso
+ *
+ * O plano  avaliado e os intervalos livres de todas as mquinas so guardados nas rvores, em tempo O(n log n).
+ * A instncia e o plano continuam a pertencer a quem os criou, mas crescem  medida que chegam novos trabalhos.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano em curso (com todas as operaes escalonadas)
+ * @param	callback	Funo chamada com o plano depois de cada chegada (ou NULL)
+ * @param	context		Dados passados  funo callback
+ * @return	Estado do escalonamento online (ou NULL se no foi possvel)
+*/
+OnlineScheduler* startOnlineScheduler(Instance* instance, Schedule* schedule, IncumbentCallback callback, void* context)
+{
+	if (instance == NULL || schedule == NULL || schedule->numberOfScheduled < instance->numberOfOperations || evaluateSchedule(instance, schedule) < 0)
+	{
+		return NULL;
+	}
+
+	OnlineScheduler* new = (OnlineScheduler*)calloc(1, sizeof(OnlineScheduler));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	new->instance = instance;
+	new->schedule = schedule;
+	new->callback = callback;
+	new->context = context;
+	new->random = newRandom((unsigned long long)instance->numberOfOperations);
+	new->capacity = instance->numberOfOperations + instance->numberOfMachines + 1;
+	new->freeGap = -1;
+	new->roots = (int*)malloc(instance->numberOfMachines * sizeof(int));
+	new->gapStart = (int*)malloc(new->capacity * sizeof(int));
+	new->gapEnd = (int*)malloc(new->capacity * sizeof(int));
+	new->gapPrevious = (int*)malloc(new->capacity * sizeof(int));
+	new->left = (int*)malloc(new->capacity * sizeof(int));
+	new->right = (int*)malloc(new->capacity * sizeof(int));
+	new->maxLength = (int*)malloc(new->capacity * sizeof(int));
+	new->priority = (unsigned int*)malloc(new->capacity * sizeof(unsigned int));
+
+	if (new->roots == NULL || new->gapStart == NULL || new->gapEnd == NULL || new->gapPrevious == NULL
+		|| new->left == NULL || new->right == NULL || new->maxLength == NULL || new->priority == NULL)
+	{
+		cleanOnlineScheduler(&new);
+		return NULL;
+	}
+
+	// intervalos livres entre as operaes de cada mquina e depois da ltima
+	for (int m = 0; m < instance->numberOfMachines; m++)
+	{
+		int previous = -1, time = schedule->machineReleaseTime[m];
+		new->roots[m] = -1;
+
+		for (int o = schedule->firstInMachine[m]; o != -1; o = schedule->nextInMachine[o])
+		{
+			if (schedule->startTime[o] > time && !insertGap(new, m, time, schedule->startTime[o], previous))
+			{
+				cleanOnlineScheduler(&new);
+				return NULL;
+			}
+
+			previous = o;
+			time = schedule->endTime[o];
+		}
+
+		if (!insertGap(new, m, time, INT_MAX, previous))
+		{
+			cleanOnlineScheduler(&new);
+			return NULL;
+		}
+	}
+
+	return new;
+}
+
+
+/**
+ * @brief	Inserir um novo trabalho no plano em curso, sem alterar as operaes j escalonadas
+ *
+ * Cada operao do trabalho, pela ordem de execuo,  colocada no intervalo livre onde termina mais cedo entre as
+ * mquinas elegveis, sem comear antes da chegada do trabalho nem do fim da operao anterior. Como s so usados
+ * intervalos onde a operao cabe por inteiro, nenhuma outra operao muda de tempo. Cada operao custa tempo
+ * logartmico no tamanho do plano (mais o crescimento amortizado dos arrays). No fim, o plano  avaliado uma vez (tempo linear),
+ * para que a ordem topolgica e as ligaes entre as operaes de cada trabalho incluam as novas operaes, e  publicado.
+ * @param	online		Estado do escalonamento online
+ * @param	arrival		Dados do novo trabalho
+ * @return	Tempo total do plano (ou -1 se no foi possvel inserir o trabalho, ficando o plano e a instncia como estavam)
+*/
+int insertJob_Online(OnlineScheduler* online, JobArrival* arrival)
+{
+	if (online == NULL || arrival == NULL)
+	{
+		return -1;
+	}
+
+	Instance* instance = online->instance;
+	Schedule* schedule = online->schedule;
+	int numberOfOperations = schedule->numberOfOperations;
+	int makespan = schedule->makespan;
+
+	int* used = (int*)malloc(4 * (arrival->numberOfOperations > 0 ? arrival->numberOfOperations : 1) * sizeof(int));
+	if (used == NULL) // se no houver memria para alocar
+	{
+		return -1;
+	}
+
+	if (!resizeSchedule(schedule, numberOfOperations + arrival->numberOfOperations))
+	{
+		free(used);
+		return -1;
+	}
+
+	int job = appendJob_AtInstance(instance, arrival);
+	if (job == -1)
+	{
+		schedule->numberOfOperations = numberOfOperations;
+		free(used);
+		return -1;
+	}
+
+	int arrivalTime = arrival->arrivalTime > 0 ? arrival->arrivalTime : 0;
+	int ready = arrivalTime;
+	int previous = -1;
+
+	for (int o = instance->jobStart[job]; o < instance->jobStart[job + 1]; o++)
+	{
+		int bestGap = -1, bestMachine = -1, bestRuntime = 0, bestStart = 0;
+
+		for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+		{
+			int start;
+			int gap = findGap(online, instance->eligibleMachines[k], ready, instance->eligibleRuntimes[k], &start);
+
+			if (gap != -1 && (bestGap == -1 || start + instance->eligibleRuntimes[k] < bestStart + bestRuntime
+				|| (start + instance->eligibleRuntimes[k] == bestStart + bestRuntime && instance->eligibleRuntimes[k] < bestRuntime)))
+			{
+				bestGap = gap;
+				bestMachine = instance->eligibleMachines[k];
+				bestRuntime = instance->eligibleRuntimes[k];
+				bestStart = start;
+			}
+		}
+
+		if (bestGap == -1)
+		{
+			undoJob_Online(online, job, used, o - instance->jobStart[job], makespan);
+			free(used);
+			return -1;
+		}
+
+		// dividir o intervalo escolhido em dois: antes e depois da operao
+		int gapStart = online->gapStart[bestGap];
+		int gapEnd = online->gapEnd[bestGap];
+		int gapPrevious = online->gapPrevious[bestGap];
+		int* current = used + 4 * (o - instance->jobStart[job]);
+
+		current[0] = bestMachine;
+		current[1] = gapStart;
+		current[2] = gapEnd;
+		current[3] = gapPrevious;
+
+		removeGap(online, bestMachine, bestGap);
+		insertOperation_AtSchedule(schedule, o, bestMachine, bestRuntime, gapPrevious);
+
+		if ((bestStart > gapStart && !insertGap(online, bestMachine, gapStart, bestStart, gapPrevious))
+			|| (gapEnd > bestStart + bestRuntime && !insertGap(online, bestMachine, bestStart + bestRuntime, gapEnd, o)))
+		{
+			undoJob_Online(online, job, used, o - instance->jobStart[job] + 1, makespan);
+			free(used);
+			return -1;
+		}
+
+		schedule->releaseTime[o] = arrivalTime;
+		schedule->startTime[o] = bestStart;
+		schedule->endTime[o] = bestStart + bestRuntime;
+		schedule->previousInJob[o] = previous;
+		schedule->nextInJob[o] = -1;
+
+		if (previous != -1)
+		{
+			schedule->nextInJob[previous] = o;
+		}
+
+		if (schedule->endTime[o] > schedule->makespan)
+		{
+			schedule->makespan = schedule->endTime[o];
+		}
+
+		previous = o;
+		ready = schedule->endTime[o];
+	}
+
+	free(used);
+
+	// os tempos no mudam, porque cada operao comea no instante mais cedo do seu intervalo, mas a ordem topolgica
+	// (usada, por exemplo, pelas caudas do plano e pela codificao em cromossoma) passa a incluir as novas operaes
+	evaluateSchedule(instance, schedule);
+
+	if (online->callback != NULL)
+	{
+		online->callback(instance, schedule, online->context);
+	}
+
+	return schedule->makespan;
+}
+
+
+/**
+ * @brief	Ler novos trabalhos de um ficheiro .csv e inseri-los no plano em curso,  medida que so lidos
+ *
+ * Cada linha tem o tempo de chegada, o identificador do trabalho, o identificador da operao, o identificador de uma
+ * mquina elegvel e o tempo de execuo nessa mquina. As linhas de cada trabalho so seguidas e as de cada operao
+ * tambm, pela ordem de execuo das operaes.
+ * @param	online		Estado do escalonamento online
+ * @param	fileName	Nome do ficheiro
+ * @return	Quantidade de trabalhos inseridos (ou -1 se no foi possvel ler o ficheiro)
+*/
+int readArrivals_Online(OnlineScheduler* online, char fileName[])
+{
+	if (online == NULL)
+	{
+		return -1;
+	}
+
+	FILE* file = fopen(fileName, "r");
+	if (file == NULL)
+	{
+		return -1;
+	}
+
+	int capacity = 16;
+	JobArrival arrival = { -1, 0, 0, NULL, NULL, NULL, NULL };
+	arrival.operationIDs = (int*)malloc(capacity * sizeof(int));
+	arrival.eligibleStart = (int*)malloc((capacity + 1) * sizeof(int));
+	arrival.machineIDs = (int*)malloc(capacity * sizeof(int));
+	arrival.runtimes = (int*)malloc(capacity * sizeof(int));
+
+	char line[FILE_LINE_SIZE];
+	int arrivalTime = 0, jobID = 0, operationID = 0, machineID = 0, runtime = 0;
+	int numberOfExecutions = 0, inserted = 0;
+	bool reading = arrival.operationIDs != NULL && arrival.eligibleStart != NULL && arrival.machineIDs != NULL && arrival.runtimes != NULL;
+
+	while (reading)
+	{
+		bool hasLine = fgets(line, FILE_LINE_SIZE, file) != NULL;
+
+		if (hasLine && sscanf(line, "%d;%d;%d;%d;%d", &arrivalTime, &jobID, &operationID, &machineID, &runtime) != 5)
+		{
+			continue; // ignora o cabealho do .csv
+		}
+
+		// inserir o trabalho anterior quando comea outro (ou quando o ficheiro termina)
+		if (arrival.numberOfOperations > 0 && (!hasLine || jobID != arrival.jobID))
+		{
+			arrival.eligibleStart[arrival.numberOfOperations] = numberOfExecutions;
+
+			if (insertJob_Online(online, &arrival) >= 0)
+			{
+				inserted++;
+			}
+
+			arrival.numberOfOperations = 0;
+			numberOfExecutions = 0;
+		}
+
+		if (!hasLine)
+		{
+			break;
+		}
+
+		if (numberOfExecutions + 1 >= capacity)
+		{
+			capacity *= 2;
+			int** fields[] = { &arrival.operationIDs, &arrival.eligibleStart, &arrival.machineIDs, &arrival.runtimes };
+
+			for (int i = 0; i < 4 && reading; i++)
+			{
+				int* grown = (int*)realloc(*fields[i], (capacity + 1) * sizeof(int));
+				if (grown == NULL) // se no houver memria para alocar
+				{
+					reading = false;
+				}
+				else
+				{
+					*fields[i] = grown;
+				}
+			}
+
+			if (!reading)
+			{
+				break;
+			}
+		}
+
+		if (arrival.numberOfOperations == 0 || arrival.operationIDs[arrival.numberOfOperations - 1] != operationID)
+		{
+			arrival.operationIDs[arrival.numberOfOperations] = operationID;
+			arrival.eligibleStart[arrival.numberOfOperations] = numberOfExecutions;
+			arrival.numberOfOperations++;
+		}
+
+		arrival.jobID = jobID;
+		arrival.arrivalTime = arrivalTime;
+		arrival.machineIDs[numberOfExecutions] = machineID;
+		arrival.runtimes[numberOfExecutions] = runtime;
+		numberOfExecutions++;
+	}
+
+	fclose(file);
+
+	free(arrival.operationIDs);
+	free(arrival.eligibleStart);
+	free(arrival.machineIDs);
+	free(arrival.runtimes);
+
+	return inserted;
+}
+
+
+/**
+ * @brief	Terminar o escalonamento online e limpar o seu estado da memria (a instncia e o plano no so limpos)
+ * @param	online	Apontador para o estado do escalonamento online
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanOnlineScheduler(OnlineScheduler** online)
+{
+	if (online == NULL || *online == NULL)
+	{
+		return false;
+	}
+
+	free((*online)->roots);
+	free((*online)->gapStart);
+	free((*online)->gapEnd);
+	free((*online)->gapPrevious);
+	free((*online)->left);
+	free((*online)->right);
+	free((*online)->maxLength);
+	free((*online)->priority);
+	free(*online);
+
+	*online = NULL;
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
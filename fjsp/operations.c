@@ -11,6 +11,10 @@
 #include "lists.h"
 
 
+// enquanto nenhuma operao foi carregada, as operaes no esto associadas aos agregados dos trabalhos
+int operationsVersion = 0;
+
+
 /**
  * @brief	Criar nova operao
  * @param	operationID		Identificador da operao
@@ -63,6 +67,10 @@ Operation* insertOperation_AtStart(Operation* head, Operation* new)
 		head = new;
 	}
 
+	dirtyData.operations = true; // a lista foi alterada desde que foi guardada
+	dirtyData.instance = true;
+	operationsVersion++;
+
 	return head;
 }
 
@@ -100,6 +108,8 @@ bool updateOperation_Name(Operation* head[], int operationID, const char* newNam
 		current = current->next;
 	}
 
+	dirtyData.operations = true;
+
 	return true;
 }
 
@@ -152,6 +162,10 @@ bool updateOperation_Position(Operation* head[], int jobID, int xOperationID, in
 		current = current->next;
 	}
 
+	dirtyData.operations = true;
+	dirtyData.instance = true;
+	operationsVersion++;
+
 	return true;
 }
 
@@ -176,6 +190,9 @@ bool deleteOperation(Operation* head[], int operationID)
 	{
 		*head = current->next;
 		free(current);
+		dirtyData.operations = true;
+		dirtyData.instance = true;
+		operationsVersion++;
 		return true;
 	}
 
@@ -192,6 +209,9 @@ bool deleteOperation(Operation* head[], int operationID)
 
 	previous->next = current->next; // desassociar o elemento da lista
 	free(current);
+	dirtyData.operations = true;
+	dirtyData.instance = true;
+	operationsVersion++;
 
 	return true;
 }
@@ -219,6 +239,9 @@ int deleteOperation_ByJob(Operation* head[], int jobID)
 		operationDeleted = current->operationID;
 		*head = current->next;
 		free(current);
+		dirtyData.operations = true;
+		dirtyData.instance = true;
+		operationsVersion++;
 
 		return operationDeleted;
 	}
@@ -237,6 +260,9 @@ int deleteOperation_ByJob(Operation* head[], int jobID)
 	operationDeleted = current->operationID;
 	previous->next = current->next; // desassociar o elemento da lista
 	free(current);
+	dirtyData.operations = true;
+	dirtyData.instance = true;
+	operationsVersion++;
 
 	return operationDeleted;
 }
@@ -582,160 +608,6 @@ Operation* getOperation_ByJob(Operation* head, int operationID, int jobID)
 }
 
 
-/**
- * @brief	Obter o mnimo de tempo necessrio para completo um trabalho e as respetivas execues
- * @param	operations		Lista de operaes
- * @param	executions		Lista de execues de operaes
- * @param	jobID			Identificador do trabalho
- * @param	minExecutions	Apontador para a lista de execues de operaes a ser devolvida, relativamente ao tempo mnimo
- * @return	Quantidade de tempo
-*/
-int getMinTime_ToCompleteJob(Operation* operations, Execution* executions, int jobID, Execution** minExecutions)
-{
-	if (operations == NULL || executions == NULL) // se as listas estiverem vazias
-	{
-		return -1;
-	}
-
-	int time = 999;
-	int counter = 0;
-
-	Operation* currentOperation = operations;
-	Execution* currentExecution = executions;
-	Execution* minExecution = NULL;
-
-	while (currentOperation != NULL) // percorrer lista de operaes
-	{
-		if (currentOperation->jobID == jobID) // se encontrar o job relativo  operao
-		{
-			while (currentExecution != NULL) // percorrer lista de execues de operaes
-			{
-				if (currentExecution->operationID == currentOperation->operationID) // se encontrar a execuo de operao relativa  operao
-				{
-					// guardar execuo de operao com menor tempo de utilizao
-					if (currentExecution->runtime < time)
-					{
-						time = currentExecution->runtime;
-						minExecution = newExecution(currentExecution->operationID, currentExecution->machineID, currentExecution->runtime);
-					}
-				}
-
-				currentExecution = currentExecution->next;
-			}
-
-			*minExecutions = insertExecution_AtStart_AtList(*minExecutions, minExecution);
-
-			// repor lista percorrida (currentExecution), para que se for necessrio voltar a percorrer o while das execues de operaes de novo
-			currentExecution = NULL;
-			currentExecution = executions;
-
-			counter += time; // acumular o tempo de utilizao de cada execuo de operao
-			time = 999; // resetar tempo para a prxima iterao
-		}
-
-		currentOperation = currentOperation->next;
-	}
-
-	return counter;
-}
-
-
-/**
- * @brief	Obter o mximo de tempo necessrio para completo um trabalho e as respetivas execues
- * @param	operations		Lista de operaes
- * @param	executions		Lista de execues de operaes
- * @param	jobID			Identificador do trabalho
- * @param	maxExecutions	Apontador para a lista de execues de operaes a ser devolvida, relativamente ao tempo mximo
- * @return	Quantidade de tempo
-*/
-int getMaxTime_ToCompleteJob(Operation* operations, Execution* executions, int jobID, Execution** maxExecutions)
-{
-	if (operations == NULL || executions == NULL) // se as listas estiverem vazias
-	{
-		return -1;
-	}
-
-	int time = 0;
-	int counter = 0;
-
-	Operation* currentOperation = operations;
-	Execution* currentExecution = executions;
-	Execution* maxExecution = NULL;
-
-	while (currentOperation != NULL) // percorrer lista de operaes
-	{
-		if (currentOperation->jobID == jobID) // se encontrar o job relativo  operao
-		{
-			while (currentExecution != NULL) // percorrer lista de execues de operaes
-			{
-				if (currentExecution->operationID == currentOperation->operationID) // se encontrar a execuo de operao relativa  operao
-				{
-					// guardar execuo de operao com maior tempo de utilizao
-					if (currentExecution->runtime > time)
-					{
-						time = currentExecution->runtime;
-						maxExecution = newExecution(currentExecution->operationID, currentExecution->machineID, currentExecution->runtime);
-					}
-				}
-
-				currentExecution = currentExecution->next;
-			}
-
-			*maxExecutions = insertExecution_AtStart_AtList(*maxExecutions, maxExecution);
-
-			// repor lista percorrida (currentExecution), para que se for necessrio voltar a percorrer o while da execues de operaes de novo
-			currentExecution = NULL;
-			currentExecution = executions;
-
-			counter += time; // acumular o tempo de utilizao de cada execuo de operao
-			time = 0; // resetar tempo de utilizao para a prxima iterao
-		}
-
-		currentOperation = currentOperation->next;
-	}
-
-	return counter;
-}
-
-
-/**
- * @brief	Obter a mdia de tempo necessrio para completar uma operao, considerando todas as alternativas possveis
- * @param	head			Lista de execues de operaes
- * @param	operationID		Identificador da operao
- * @return	Valor da mdia de tempo
-*/
-float getAverageTime_ToCompleteOperation(Execution* head, int operationID)
-{
-	if (head == NULL)
-	{
-		return -1.0f;
-	}
-
-	int sum = 0;
-	float average = 0;
-	float numberOfExecutions = 0;
-
-	Execution* current = head;
-
-	while (current != NULL)
-	{
-		if (current->operationID == operationID) // se encontrar a execuo de operao relativa  operao
-		{
-			sum += current->runtime;
-			numberOfExecutions++;
-		}
-		current = current->next;
-	}
-
-	if (numberOfExecutions > 0) // para no permitir diviso por 0
-	{
-		average = sum / numberOfExecutions;
-	}
-
-	return average;
-}
-
-
 /**
  * @brief	Contar o nmero de operaes existentes na lista de operaes
  * @param	head	Lista de operaes
@@ -782,5 +654,9 @@ bool cleanOperations(Operation* head[])
 		free(current);
 	}
 
+	dirtyData.operations = true;
+	dirtyData.instance = true;
+	operationsVersion++;
+
 	return false;
 }
\ No newline at end of file
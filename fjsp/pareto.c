@@ -0,0 +1,897 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao escalonamento multiobjetivo (NSGA-II e arquivo da frente de Pareto).
+ * @file	pareto.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+#define CROWDING_INFINITY 1e30 // distncia de aglomerao dos extremos da frente
+
+
+/**
+ * @brief	Indivduo da populao: cromossoma (atribuio de mquinas e sequncia de trabalhos) e avaliao
+*/
+typedef struct Individual
+{
+	int* assignment; // posio (em eligibleMachines) da mquina de cada operao
+	int* sequence; // ndices dos trabalhos, cada um repetido tantas vezes quantas as suas operaes
+	int objectives[NUMBER_OF_OBJECTIVES];
+	unsigned long long fingerprint; // impresso digital do plano
+	int rank; // ndice da frente no dominada
+	double crowding; // distncia de aglomerao dentro da frente
+} Individual;
+
+
+/**
+ * @brief	Escada de uma frente: pontos por ordem crescente do segundo objetivo e decrescente do terceiro
+*/
+typedef struct Staircase
+{
+	int* points;
+	int size;
+	int capacity;
+} Staircase;
+
+
+#pragma region ordenao no dominada
+
+/**
+ * @brief	Ordenar ndices por um objetivo (ordenao por fuso, estvel)
+ * @param	items		ndices a ordenar
+ * @param	buffer		Memria auxiliar (do mesmo tamanho)
+ * @param	count		Quantidade de ndices
+ * @param	objectives	Objetivos de todos os pontos (NUMBER_OF_OBJECTIVES por ponto)
+ * @param	objective	Objetivo usado na comparao
+*/
+static void sortByObjective(int* items, int* buffer, int count, int* objectives, int objective)
+{
+	for (int width = 1; width < count; width *= 2)
+	{
+		for (int start = 0; start < count; start += 2 * width)
+		{
+			int middle = start + width < count ? start + width : count;
+			int end = start + 2 * width < count ? start + 2 * width : count;
+			int i = start, j = middle, k = start;
+
+			while (i < middle && j < end)
+			{
+				buffer[k++] = objectives[items[j] * NUMBER_OF_OBJECTIVES + objective] < objectives[items[i] * NUMBER_OF_OBJECTIVES + objective]
+					? items[j++] : items[i++];
+			}
+
+			while (i < middle)
+			{
+				buffer[k++] = items[i++];
+			}
+
+			while (j < end)
+			{
+				buffer[k++] = items[j++];
+			}
+		}
+
+		memcpy(items, buffer, count * sizeof(int));
+	}
+}
+
+
+/**
+ * @brief	Verificar se um ponto  dominado por algum ponto de uma frente (todos os pontos da frente vm antes na ordem lexicogrfica)
+ * @param	staircase	Escada da frente
+ * @param	objectives	Objetivos de todos os pontos
+ * @param	point		ndice do ponto
+ * @param	position	Onde  guardado o nmero de pontos da escada com segundo objetivo menor ou igual ao do ponto
+ * @return	Booleano para o resultado da funo (se  dominado ou no)
+*/
+static bool isDominated_ByStaircase(Staircase* staircase, int* objectives, int point, int* position)
+{
+	int* p = objectives + point * NUMBER_OF_OBJECTIVES;
+	int low = 0, high = staircase->size;
+
+	// ltimo ponto da escada com segundo objetivo menor ou igual (pesquisa binria)
+	while (low < high)
+	{
+		int middle = (low + high) / 2;
+
+		if (objectives[staircase->points[middle] * NUMBER_OF_OBJECTIVES + 1] <= p[1])
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	*position = low;
+
+	if (low == 0)
+	{
+		return false;
+	}
+
+	int* q = objectives + staircase->points[low - 1] * NUMBER_OF_OBJECTIVES;
+
+	// o primeiro objetivo de q  menor ou igual pela ordem; pontos iguais no se dominam
+	return q[2] <= p[2] && (q[0] != p[0] || q[1] != p[1] || q[2] != p[2]);
+}
+
+
+/**
+ * @brief	Inserir um ponto na escada de uma frente, retirando os pontos que passam a ser dominados na projeo
+ * @param	staircase	Escada da frente
+ * @param	objectives	Objetivos de todos os pontos
+ * @param	point		ndice do ponto
+ * @param	position	Posio devolvida por isDominated_ByStaircase
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool insertPoint_AtStaircase(Staircase* staircase, int* objectives, int point, int position)
+{
+	int* p = objectives + point * NUMBER_OF_OBJECTIVES;
+
+	if (position > 0 && objectives[staircase->points[position - 1] * NUMBER_OF_OBJECTIVES + 2] <= p[2])
+	{
+		return true; // ponto igual j representado na escada
+	}
+
+	// pontos seguintes com terceiro objetivo maior ou igual deixam de ser necessrios
+	int end = position;
+	while (end < staircase->size && objectives[staircase->points[end] * NUMBER_OF_OBJECTIVES + 2] >= p[2])
+	{
+		end++;
+	}
+
+	if (end == position && staircase->size == staircase->capacity)
+	{
+		int capacity = staircase->capacity == 0 ? 8 : staircase->capacity * 2;
+		int* points = (int*)realloc(staircase->points, capacity * sizeof(int));
+
+		if (points == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		staircase->points = points;
+		staircase->capacity = capacity;
+	}
+
+	memmove(staircase->points + position + 1, staircase->points + end, (staircase->size - end) * sizeof(int));
+	staircase->points[position] = point;
+	staircase->size += 1 - (end - position);
+
+	return true;
+}
+
+
+/**
+ * @brief	Ordenao no dominada rpida (trs objetivos, a minimizar)
+ *
+ * Os pontos so processados por ordem lexicogrfica, para que nenhum ponto seja dominado por um ponto processado depois.
+ * Cada ponto vai para a primeira frente que no o domina, encontrada por pesquisa binria sobre as frentes (se uma frente o domina,
+ * todas as anteriores tambm). Cada frente guarda a escada dos pontos no dominados na projeo nos dois ltimos objetivos,
+ * pelo que cada teste de dominncia  uma pesquisa binria: O(n log n) comparaes por cada nvel da pesquisa sobre as frentes.
+ * @param	count		Quantidade de pontos
+ * @param	objectives	Objetivos de todos os pontos (NUMBER_OF_OBJECTIVES por ponto)
+ * @param	rank		Array onde  guardado o ndice da frente de cada ponto
+ * @return	Quantidade de frentes (ou -1 se no houver memria)
+*/
+static int sortNonDominated(int count, int* objectives, int* rank)
+{
+	int* order = (int*)malloc(count * sizeof(int));
+	int* buffer = (int*)malloc(count * sizeof(int));
+	Staircase* fronts = (Staircase*)calloc(count, sizeof(Staircase));
+
+	// se no houver memria para alocar
+	if (order == NULL || buffer == NULL || fronts == NULL)
+	{
+		free(order);
+		free(buffer);
+		free(fronts);
+		return -1;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		order[i] = i;
+	}
+
+	// ordem lexicogrfica: ordenaes estveis do ltimo para o primeiro objetivo
+	for (int objective = NUMBER_OF_OBJECTIVES - 1; objective >= 0; objective--)
+	{
+		sortByObjective(order, buffer, count, objectives, objective);
+	}
+
+	int numberOfFronts = 0;
+	bool success = true;
+
+	for (int i = 0; i < count && success; i++)
+	{
+		int point = order[i], position = 0;
+		int low = 0, high = numberOfFronts;
+
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+
+			if (isDominated_ByStaircase(&fronts[middle], objectives, point, &position))
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		if (low == numberOfFronts)
+		{
+			numberOfFronts++;
+		}
+
+		isDominated_ByStaircase(&fronts[low], objectives, point, &position);
+		success = insertPoint_AtStaircase(&fronts[low], objectives, point, position);
+		rank[point] = low;
+	}
+
+	for (int f = 0; f < numberOfFronts; f++)
+	{
+		free(fronts[f].points);
+	}
+
+	free(order);
+	free(buffer);
+	free(fronts);
+
+	return success ? numberOfFronts : -1;
+}
+
+
+/**
+ * @brief	Calcular a distncia de aglomerao dos pontos de uma frente
+ * @param	members		ndices dos pontos da frente (a ordem  alterada)
+ * @param	buffer		Memria auxiliar (do mesmo tamanho)
+ * @param	count		Quantidade de pontos
+ * @param	objectives	Objetivos de todos os pontos
+ * @param	crowding	Array onde  guardada a distncia de cada ponto (indexado pelo ponto)
+*/
+static void computeCrowding(int* members, int* buffer, int count, int* objectives, double* crowding)
+{
+	for (int i = 0; i < count; i++)
+	{
+		crowding[members[i]] = 0;
+	}
+
+	for (int objective = 0; objective < NUMBER_OF_OBJECTIVES; objective++)
+	{
+		sortByObjective(members, buffer, count, objectives, objective);
+
+		int minimum = objectives[members[0] * NUMBER_OF_OBJECTIVES + objective];
+		int maximum = objectives[members[count - 1] * NUMBER_OF_OBJECTIVES + objective];
+
+		crowding[members[0]] = CROWDING_INFINITY;
+		crowding[members[count - 1]] = CROWDING_INFINITY;
+
+		if (maximum == minimum)
+		{
+			continue;
+		}
+
+		for (int i = 1; i < count - 1; i++)
+		{
+			crowding[members[i]] += (double)(objectives[members[i + 1] * NUMBER_OF_OBJECTIVES + objective]
+				- objectives[members[i - 1] * NUMBER_OF_OBJECTIVES + objective]) / (maximum - minimum);
+		}
+	}
+}
+
+#pragma endregion
+
+
+#pragma region arquivo da frente de Pareto
+
+/**
+ * @brief	Calcular os objetivos de um plano completo e avaliado
+ * @param	schedule	Plano
+ * @param	objectives	Array onde so guardados os objetivos
+*/
+static void getObjectives(Schedule* schedule, int* objectives)
+{
+	int total = 0, maximum = 0;
+
+	for (int k = 0; k < schedule->numberOfMachines; k++)
+	{
+		int load = 0;
+
+		for (int o = schedule->firstInMachine[k]; o != -1; o = schedule->nextInMachine[o])
+		{
+			load += schedule->assignedRuntime[o];
+		}
+
+		total += load;
+		maximum = load > maximum ? load : maximum;
+	}
+
+	objectives[0] = schedule->makespan;
+	objectives[1] = total;
+	objectives[2] = maximum;
+}
+
+
+/**
+ * @brief	Verificar se um vetor de objetivos domina outro (menor ou igual em todos e menor em pelo menos um)
+*/
+static bool dominates(int* first, int* second)
+{
+	bool better = false;
+
+	for (int k = 0; k < NUMBER_OF_OBJECTIVES; k++)
+	{
+		if (first[k] > second[k])
+		{
+			return false;
+		}
+
+		better = better || first[k] < second[k];
+	}
+
+	return better;
+}
+
+
+/**
+ * @brief	Criar um arquivo vazio para a frente de Pareto
+ * @param	instance	Instncia do problema
+ * @param	capacity	Quantidade mxima de planos guardados
+ * @return	Arquivo criado (ou NULL se no houver memria)
+*/
+ParetoArchive* newParetoArchive(Instance* instance, int capacity)
+{
+	if (instance == NULL || capacity <= 0)
+	{
+		return NULL;
+	}
+
+	ParetoArchive* new = (ParetoArchive*)calloc(1, sizeof(ParetoArchive));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	// mais um lugar para o plano que entra antes de descartar o mais aglomerado
+	new->capacity = capacity;
+	new->plans = (Schedule**)calloc(capacity + 1, sizeof(Schedule*));
+	new->objectives = (int*)malloc((capacity + 1) * NUMBER_OF_OBJECTIVES * sizeof(int));
+
+	if (new->plans == NULL || new->objectives == NULL)
+	{
+		cleanParetoArchive(&new);
+		return NULL;
+	}
+
+	return new;
+}
+
+
+/**
+ * @brief	Inserir um plano no arquivo, se no for dominado por nenhum plano guardado
+ *
+ * Os planos guardados dominados pelo novo so descartados. Se o arquivo ficar acima da capacidade,  descartado o plano
+ * com menor distncia de aglomerao (os extremos da frente nunca so descartados).
+ * @param	archive		Arquivo
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano completo e avaliado ( copiado)
+ * @return	Booleano para o resultado da funo (se o plano entrou no arquivo ou no)
+*/
+bool insertSchedule_AtArchive(ParetoArchive* archive, Instance* instance, Schedule* schedule)
+{
+	if (archive == NULL || instance == NULL || schedule == NULL || schedule->numberOfScheduled < instance->numberOfOperations)
+	{
+		return false;
+	}
+
+	int objectives[NUMBER_OF_OBJECTIVES];
+	getObjectives(schedule, objectives);
+
+	for (int i = 0; i < archive->size; i++)
+	{
+		int* member = archive->objectives + i * NUMBER_OF_OBJECTIVES;
+
+		if (dominates(member, objectives) || memcmp(member, objectives, sizeof(objectives)) == 0)
+		{
+			return false;
+		}
+	}
+
+	// descartar os planos dominados pelo novo (os objetos dos planos so reutilizados)
+	int size = 0;
+
+	for (int i = 0; i < archive->size; i++)
+	{
+		if (dominates(objectives, archive->objectives + i * NUMBER_OF_OBJECTIVES))
+		{
+			continue;
+		}
+
+		Schedule* plan = archive->plans[size];
+		archive->plans[size] = archive->plans[i];
+		archive->plans[i] = plan;
+		memmove(archive->objectives + size * NUMBER_OF_OBJECTIVES, archive->objectives + i * NUMBER_OF_OBJECTIVES, sizeof(objectives));
+		size++;
+	}
+
+	archive->size = size;
+
+	if (archive->plans[size] == NULL)
+	{
+		archive->plans[size] = newSchedule(instance);
+
+		if (archive->plans[size] == NULL)
+		{
+			return false;
+		}
+	}
+
+	copySchedule(archive->plans[size], schedule);
+	memcpy(archive->objectives + size * NUMBER_OF_OBJECTIVES, objectives, sizeof(objectives));
+	archive->size++;
+
+	if (archive->size <= archive->capacity)
+	{
+		return true;
+	}
+
+	// descartar o plano mais aglomerado
+	int* memberIndices = (int*)malloc(2 * archive->size * sizeof(int));
+	double* distances = (double*)malloc(archive->size * sizeof(double));
+
+	if (memberIndices == NULL || distances == NULL) // se no houver memria para alocar
+	{
+		free(memberIndices);
+		free(distances);
+		archive->size--; // o novo plano no fica no arquivo
+		return false;
+	}
+
+	for (int i = 0; i < archive->size; i++)
+	{
+		memberIndices[i] = i;
+	}
+
+	computeCrowding(memberIndices, memberIndices + archive->size, archive->size, archive->objectives, distances);
+
+	int removed = 0;
+	for (int i = 1; i < archive->size; i++)
+	{
+		removed = distances[i] < distances[removed] ? i : removed;
+	}
+
+	archive->size--;
+
+	Schedule* plan = archive->plans[removed];
+	archive->plans[removed] = archive->plans[archive->size];
+	archive->plans[archive->size] = plan;
+	memcpy(archive->objectives + removed * NUMBER_OF_OBJECTIVES, archive->objectives + archive->size * NUMBER_OF_OBJECTIVES, sizeof(objectives));
+
+	free(memberIndices);
+	free(distances);
+
+	return removed != archive->size;
+}
+
+
+/**
+ * @brief	Libertar a memria do arquivo e dos seus planos
+ * @param	archive		Apontador para o arquivo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanParetoArchive(ParetoArchive** archive)
+{
+	if (archive == NULL || *archive == NULL)
+	{
+		return false;
+	}
+
+	if ((*archive)->plans != NULL)
+	{
+		for (int i = 0; i <= (*archive)->capacity; i++)
+		{
+			cleanSchedule(&(*archive)->plans[i]);
+		}
+	}
+
+	free((*archive)->plans);
+	free((*archive)->objectives);
+	free(*archive);
+	*archive = NULL;
+
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region NSGA-II
+
+/**
+ * @brief	Escolher um indivduo por torneio binrio (menor frente, e depois maior distncia de aglomerao)
+*/
+static int selectByTournament(Individual* population, int populationSize, Random* random)
+{
+	int first = nextRandom_Int(random, populationSize);
+	int second = nextRandom_Int(random, populationSize);
+
+	if (population[first].rank != population[second].rank)
+	{
+		return population[first].rank < population[second].rank ? first : second;
+	}
+
+	return population[first].crowding >= population[second].crowding ? first : second;
+}
+
+
+/**
+ * @brief	Gerar um descendente: cruzamento uniforme das atribuies, cruzamento por subconjunto de trabalhos (POX) das sequncias e mutao
+ * @param	instance	Instncia do problema
+ * @param	first		Primeiro progenitor
+ * @param	second		Segundo progenitor
+ * @param	child		Descendente (os arrays so preenchidos)
+ * @param	keepJob		Memria auxiliar (tamanho igual  quantidade de trabalhos)
+ * @param	mutate		Se true, a mutao  sempre aplicada (usado quando o descendente repete um plano da populao)
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+*/
+static void generateChild(Instance* instance, Individual* first, Individual* second, Individual* child, bool* keepJob, bool mutate, Random* random)
+{
+	crossoverChromosomes(instance, first->assignment, first->sequence, second->assignment, second->sequence, child->assignment, child->sequence,
+		keepJob, random);
+
+	if (mutate || nextRandom_Float(random) < PARETO_MUTATION_RATE)
+	{
+		mutateChromosome(instance, child->assignment, child->sequence, random);
+	}
+}
+
+
+/**
+ * @brief	Avaliar um indivduo, construindo o seu plano
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool evaluateIndividual(Instance* instance, Individual* individual, Schedule* schedule)
+{
+	if (buildSchedule_Decoded(instance, schedule, individual->assignment, individual->sequence, 0, NULL, NULL) < 0)
+	{
+		return false;
+	}
+
+	getObjectives(schedule, individual->objectives);
+	individual->fingerprint = schedule->fingerprint;
+
+	return true;
+}
+
+
+/**
+ * @brief	Avaliar vrios indivduos de uma vez, sem construir os planos (o tempo total e a impresso digital vm de evaluateChromosomes_Batch
+ *			e as cargas das mquinas da atribuio)
+ * @param	instance		Instncia do problema
+ * @param	individuals		Indivduos
+ * @param	count			Quantidade de indivduos
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool evaluateIndividuals_Batch(Instance* instance, Individual* individuals, int count)
+{
+	int** assignments = (int**)malloc(count * sizeof(int*));
+	int** sequences = (int**)malloc(count * sizeof(int*));
+	int* makespans = (int*)malloc(count * sizeof(int));
+	unsigned long long* fingerprints = (unsigned long long*)malloc(count * sizeof(unsigned long long));
+	int* loads = (int*)malloc(instance->numberOfMachines * sizeof(int));
+
+	bool success = assignments != NULL && sequences != NULL && makespans != NULL && fingerprints != NULL && loads != NULL;
+
+	for (int i = 0; i < count && success; i++)
+	{
+		assignments[i] = individuals[i].assignment;
+		sequences[i] = individuals[i].sequence;
+	}
+
+	success = success && evaluateChromosomes_Batch(instance, assignments, sequences, count, makespans, fingerprints);
+
+	for (int i = 0; i < count && success; i++)
+	{
+		int total = 0, maximum = 0;
+
+		memset(loads, 0, instance->numberOfMachines * sizeof(int));
+		for (int o = 0; o < instance->numberOfOperations; o++)
+		{
+			int k = individuals[i].assignment[o];
+
+			loads[instance->eligibleMachines[k]] += instance->eligibleRuntimes[k];
+			total += instance->eligibleRuntimes[k];
+		}
+
+		for (int m = 0; m < instance->numberOfMachines; m++)
+		{
+			maximum = loads[m] > maximum ? loads[m] : maximum;
+		}
+
+		individuals[i].objectives[0] = makespans[i];
+		individuals[i].objectives[1] = total;
+		individuals[i].objectives[2] = maximum;
+		individuals[i].fingerprint = fingerprints[i];
+	}
+
+	free(assignments);
+	free(sequences);
+	free(makespans);
+	free(fingerprints);
+	free(loads);
+
+	return success;
+}
+
+
+/**
+ * @brief	Ordenar a populao combinada por frentes e distncia de aglomerao e manter os melhores nas primeiras posies
+ * @param	population		Populao combinada (progenitores e descendentes)
+ * @param	count			Tamanho da populao combinada
+ * @param	populationSize	Quantidade de indivduos que ficam
+ * @param	objectives		Memria auxiliar (NUMBER_OF_OBJECTIVES por indivduo)
+ * @param	rank			Memria auxiliar (um por indivduo)
+ * @param	members			Memria auxiliar (dois por indivduo)
+ * @param	crowding		Memria auxiliar (um por indivduo)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool selectSurvivors(Individual* population, int count, int populationSize, int* objectives, int* rank, int* members, double* crowding)
+{
+	for (int i = 0; i < count; i++)
+	{
+		memcpy(objectives + i * NUMBER_OF_OBJECTIVES, population[i].objectives, sizeof(population[i].objectives));
+	}
+
+	int numberOfFronts = sortNonDominated(count, objectives, rank);
+	if (numberOfFronts < 0)
+	{
+		return false;
+	}
+
+	// agrupar os indivduos por frente (ordenao por contagem)
+	int* frontStart = (int*)calloc(numberOfFronts + 1, sizeof(int));
+	if (frontStart == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		frontStart[rank[i] + 1]++;
+	}
+
+	for (int f = 0; f < numberOfFronts; f++)
+	{
+		frontStart[f + 1] += frontStart[f];
+	}
+
+	int* grouped = members + count;
+	for (int i = 0; i < count; i++)
+	{
+		grouped[frontStart[rank[i]]++] = i;
+	}
+
+	for (int f = numberOfFronts; f > 0; f--)
+	{
+		frontStart[f] = frontStart[f - 1];
+	}
+	frontStart[0] = 0;
+
+	for (int f = 0; f < numberOfFronts; f++)
+	{
+		computeCrowding(grouped + frontStart[f], members, frontStart[f + 1] - frontStart[f], objectives, crowding);
+	}
+
+	// ordenar a ltima frente que no cabe toda por distncia de aglomerao decrescente
+	for (int f = 0; f < numberOfFronts; f++)
+	{
+		if (frontStart[f] < populationSize && frontStart[f + 1] > populationSize)
+		{
+			for (int i = frontStart[f] + 1; i < frontStart[f + 1]; i++)
+			{
+				int member = grouped[i], j = i;
+
+				while (j > frontStart[f] && crowding[grouped[j - 1]] < crowding[member])
+				{
+					grouped[j] = grouped[j - 1];
+					j--;
+				}
+
+				grouped[j] = member;
+			}
+		}
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		population[i].rank = rank[i];
+		population[i].crowding = crowding[i];
+	}
+
+	// colocar os indivduos pela nova ordem (cpias rasas, os arrays dos cromossomas mudam apenas de lugar)
+	Individual* ordered = (Individual*)malloc(count * sizeof(Individual));
+
+	if (ordered == NULL) // se no houver memria para alocar
+	{
+		free(frontStart);
+		return false;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		ordered[i] = population[grouped[i]];
+	}
+
+	memcpy(population, ordered, count * sizeof(Individual));
+
+	free(ordered);
+	free(frontStart);
+
+	return true;
+}
+
+
+/**
+ * @brief	Resolver o escalonamento multiobjetivo (tempo total, carga total e maior carga de uma mquina) com NSGA-II
+ *
+ * Cada indivduo  uma atribuio de mquinas e uma sequncia de trabalhos, transformados em plano por buildSchedule_Decoded.
+ * A populao inicial e os descendentes de cada gerao so avaliados em lote (evaluateChromosomes_Batch), sem construir os planos.
+ * A populao inicial inclui a atribuio com equilbrio de carga e a das mquinas mais rpidas; as restantes so aleatrias.
+ * Descendentes que repetem um plano da populao (mesma impresso digital) so mutados de novo, para manter a diversidade.
+ * Em cada gerao, progenitores e descendentes so ordenados por frentes no dominadas e distncia de aglomerao,
+ * e os planos da primeira frente so inseridos no arquivo. O resultado  sempre o mesmo para a mesma semente.
+ * @param	instance		Instncia do problema
+ * @param	archive			Arquivo onde so guardados os planos no dominados
+ * @param	populationSize	Quantidade de indivduos da populao
+ * @param	generations		Quantidade de geraes
+ * @param	seed			Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Quantidade de planos no arquivo (ou -1 se no foi possvel resolver)
+*/
+int solveSchedule_Pareto(Instance* instance, ParetoArchive* archive, int populationSize, int generations, unsigned long long seed)
+{
+	if (instance == NULL || archive == NULL || populationSize < 2 || instance->numberOfOperations == 0)
+	{
+		return -1;
+	}
+
+	int n = instance->numberOfOperations;
+	int count = 2 * populationSize;
+
+	Individual* population = (Individual*)calloc(count, sizeof(Individual));
+	Schedule* schedule = newSchedule(instance);
+	int* objectives = (int*)malloc(count * NUMBER_OF_OBJECTIVES * sizeof(int));
+	int* rank = (int*)malloc(count * sizeof(int));
+	int* members = (int*)malloc(2 * count * sizeof(int));
+	double* crowding = (double*)malloc(count * sizeof(double));
+	bool* keepJob = (bool*)malloc(instance->numberOfJobs * sizeof(bool));
+	int* machines = (int*)malloc(n * sizeof(int));
+	int* runtimes = (int*)malloc(n * sizeof(int));
+	int* parents = (int*)malloc(2 * count * sizeof(int));
+	FingerprintSet* fingerprints = newFingerprintSet(count);
+
+	bool success = population != NULL && schedule != NULL && objectives != NULL && rank != NULL && members != NULL && crowding != NULL
+		&& keepJob != NULL && machines != NULL && runtimes != NULL && parents != NULL && fingerprints != NULL;
+
+	for (int i = 0; i < count && success; i++)
+	{
+		population[i].assignment = (int*)malloc(n * sizeof(int));
+		population[i].sequence = (int*)malloc(n * sizeof(int));
+		success = population[i].assignment != NULL && population[i].sequence != NULL;
+	}
+
+	Random random = newRandom(seed);
+
+	// populao inicial
+	for (int i = 0; i < populationSize && success; i++)
+	{
+		Individual* individual = &population[i];
+
+		success = fillChromosome_Random(instance, individual->assignment, individual->sequence, &random);
+
+		if (i == 0 && assignMachines_LoadBalanced(instance, machines, runtimes) >= 0 && buildSchedule_Assigned(instance, schedule, machines, runtimes) >= 0)
+		{
+			success = encodeSchedule(instance, schedule, individual->assignment, individual->sequence);
+		}
+		else if (i == 1)
+		{
+			for (int o = 0; o < n; o++)
+			{
+				for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+				{
+					if (instance->eligibleRuntimes[k] < instance->eligibleRuntimes[individual->assignment[o]])
+					{
+						individual->assignment[o] = k;
+					}
+				}
+			}
+		}
+	}
+
+	success = success && evaluateIndividuals_Batch(instance, population, populationSize);
+
+	for (int generation = 0; generation < generations && success; generation++)
+	{
+		clearFingerprintSet(fingerprints);
+		for (int i = 0; i < populationSize; i++)
+		{
+			insertFingerprint_AtSet(fingerprints, population[i].fingerprint);
+		}
+
+		// descendentes nas posies a seguir  populao, avaliados todos de uma vez
+		for (int i = populationSize; i < count; i++)
+		{
+			parents[2 * i] = selectByTournament(population, populationSize, &random);
+			parents[2 * i + 1] = selectByTournament(population, populationSize, &random);
+
+			generateChild(instance, &population[parents[2 * i]], &population[parents[2 * i + 1]], &population[i], keepJob, false, &random);
+		}
+
+		success = success && evaluateIndividuals_Batch(instance, population + populationSize, populationSize);
+
+		// um descendente que repete um plano j presente volta a ser mutado
+		for (int i = populationSize; i < count && success; i++)
+		{
+			for (int attempt = 0; attempt < PARETO_DUPLICATE_ATTEMPTS && success && !insertFingerprint_AtSet(fingerprints, population[i].fingerprint); attempt++)
+			{
+				generateChild(instance, &population[parents[2 * i]], &population[parents[2 * i + 1]], &population[i], keepJob, true, &random);
+				success = evaluateIndividual(instance, &population[i], schedule);
+			}
+		}
+
+		success = success && selectSurvivors(population, count, populationSize, objectives, rank, members, crowding);
+
+		// planos da primeira frente para o arquivo
+		for (int i = 0; i < populationSize && success && population[i].rank == 0; i++)
+		{
+			bool dominated = false;
+
+			for (int a = 0; a < archive->size && !dominated; a++)
+			{
+				int* member = archive->objectives + a * NUMBER_OF_OBJECTIVES;
+				dominated = dominates(member, population[i].objectives) || memcmp(member, population[i].objectives, sizeof(population[i].objectives)) == 0;
+			}
+
+			if (!dominated)
+			{
+				success = evaluateIndividual(instance, &population[i], schedule);
+				insertSchedule_AtArchive(archive, instance, schedule);
+			}
+		}
+	}
+
+	for (int i = 0; i < count && population != NULL; i++)
+	{
+		free(population[i].assignment);
+		free(population[i].sequence);
+	}
+
+	free(population);
+	cleanSchedule(&schedule);
+	free(objectives);
+	free(rank);
+	free(members);
+	free(crowding);
+	free(keepJob);
+	free(machines);
+	free(runtimes);
+	free(parents);
+	cleanFingerprintSet(&fingerprints);
+
+	return success ? archive->size : -1;
+}
+
+#pragma endregion
\ No newline at end of file
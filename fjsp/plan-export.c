@@ -0,0 +1,243 @@
+/**
+ * @brief	Ficheiro com todas as funes para exportar planos por intervalos de tempo em vrios formatos.
+ * @file	plan-export.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "scheduling.h"
+
+
+#pragma region exportao de planos
+
+/**
+ * @brief	Escrever texto no buffer
+ * @param	cursor	Posio atual no buffer
+ * @param	text	Texto
+ * @param	length	Tamanho do texto
+ * @return	Posio a seguir ao texto escrito
+*/
+static char* appendText(char* cursor, const char* text, int length)
+{
+	memcpy(cursor, text, length);
+
+	return cursor + length;
+}
+
+
+/**
+ * @brief	Escrever um inteiro em decimal no buffer (sem passar pelo printf)
+ * @param	cursor	Posio atual no buffer
+ * @param	value	Inteiro
+ * @return	Posio a seguir ao inteiro escrito
+*/
+static char* appendInteger(char* cursor, int value)
+{
+	char digits[12];
+	int length = 0;
+	unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+
+	if (value < 0)
+	{
+		*cursor++ = '-';
+	}
+
+	do
+	{
+		digits[length++] = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	while (length > 0)
+	{
+		*cursor++ = digits[--length];
+	}
+
+	return cursor;
+}
+
+
+/**
+ * @brief	Escrever um inteiro em binrio (4 bytes, pela ordem de bytes da mquina) no buffer
+ * @param	cursor	Posio atual no buffer
+ * @param	value	Inteiro
+ * @return	Posio a seguir ao inteiro escrito
+*/
+static char* appendBinary(char* cursor, int value)
+{
+	memcpy(cursor, &value, sizeof(int));
+
+	return cursor + sizeof(int);
+}
+
+
+/**
+ * @brief	Criar um exportador de planos
+ * @param	fileName	Nome do ficheiro para onde os planos so exportados
+ * @param	format		Formato do ficheiro
+ * @return	Exportador criado (ou NULL se no houver memria ou o formato no existir)
+*/
+PlanExporter* newPlanExporter(char fileName[], PlanFormat format)
+{
+	if (fileName == NULL || format < 0 || format >= NUMBER_OF_PLAN_FORMATS)
+	{
+		return NULL;
+	}
+
+	PlanExporter* new = (PlanExporter*)calloc(1, sizeof(PlanExporter));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	new->format = format;
+	strncpy(new->fileName, fileName, FILE_LINE_SIZE - 1);
+	new->fileName[FILE_LINE_SIZE - 1] = '\0'; // assegura que o nome termina com '\0'
+
+	return new;
+}
+
+
+/**
+ * @brief	Exportar um plano para o ficheiro do exportador
+ *
+ * As operaes so percorridas diretamente no plano, por mquina e pela sequncia em cada mquina, e formatadas num buffer
+ * (reutilizado entre exportaes), que  escrito no ficheiro de uma s vez.
+ * No formato binrio, o ficheiro comea com PLAN_BINARY_MAGIC, a verso, a quantidade de operaes e o tempo total do plano,
+ * seguidos da mquina, trabalho, operao, tempo inicial e tempo final de cada operao.
+ * @param	exporter	Exportador de planos
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano avaliado
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool exportSchedule(PlanExporter* exporter, Instance* instance, Schedule* schedule)
+{
+	if (exporter == NULL || instance == NULL || schedule == NULL)
+	{
+		return false;
+	}
+
+	long long needed = 8 + 4 * sizeof(int) + (long long)schedule->numberOfOperations * PLAN_EXPORT_LINE_SIZE;
+
+	if (needed > exporter->capacity)
+	{
+		char* grown = (char*)realloc(exporter->buffer, needed);
+		if (grown == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		exporter->buffer = grown;
+		exporter->capacity = needed;
+	}
+
+	char* cursor = exporter->buffer;
+	char* countPosition = NULL;
+	int count = 0;
+
+	if (exporter->format == PLAN_FORMAT_BINARY)
+	{
+		cursor = appendText(cursor, PLAN_BINARY_MAGIC, 8);
+		cursor = appendBinary(cursor, PLAN_BINARY_VERSION);
+		countPosition = cursor; // a quantidade de operaes  escrita no fim
+		cursor = appendBinary(cursor, 0);
+		cursor = appendBinary(cursor, schedule->makespan);
+		cursor = appendBinary(cursor, 0); // reservado
+	}
+
+	for (int m = 0; m < instance->numberOfMachines; m++)
+	{
+		for (int o = schedule->firstInMachine[m]; o != -1; o = schedule->nextInMachine[o], count++)
+		{
+			int machineID = instance->machineIDs[m];
+			int jobID = instance->jobIDs[instance->operationJob[o]];
+
+			switch (exporter->format)
+			{
+			case PLAN_FORMAT_CSV:
+				cursor = appendText(cursor, "Maquina ", 8);
+				cursor = appendInteger(cursor, machineID);
+				cursor = appendText(cursor, ", Trabalho ", 11);
+				cursor = appendInteger(cursor, jobID);
+				cursor = appendText(cursor, " - Operacao ", 12);
+				cursor = appendInteger(cursor, instance->operationIDs[o]);
+				cursor = appendText(cursor, ", ", 2);
+				cursor = appendInteger(cursor, schedule->startTime[o]);
+				cursor = appendText(cursor, ", ", 2);
+				cursor = appendInteger(cursor, schedule->endTime[o]);
+				*cursor++ = '\n';
+				break;
+
+			case PLAN_FORMAT_JSON_LINES:
+				cursor = appendText(cursor, "{\"machine\":", 11);
+				cursor = appendInteger(cursor, machineID);
+				cursor = appendText(cursor, ",\"job\":", 7);
+				cursor = appendInteger(cursor, jobID);
+				cursor = appendText(cursor, ",\"operation\":", 13);
+				cursor = appendInteger(cursor, instance->operationIDs[o]);
+				cursor = appendText(cursor, ",\"start\":", 9);
+				cursor = appendInteger(cursor, schedule->startTime[o]);
+				cursor = appendText(cursor, ",\"end\":", 7);
+				cursor = appendInteger(cursor, schedule->endTime[o]);
+				cursor = appendText(cursor, "}\n", 2);
+				break;
+
+			default:
+				cursor = appendBinary(cursor, machineID);
+				cursor = appendBinary(cursor, jobID);
+				cursor = appendBinary(cursor, instance->operationIDs[o]);
+				cursor = appendBinary(cursor, schedule->startTime[o]);
+				cursor = appendBinary(cursor, schedule->endTime[o]);
+				break;
+			}
+		}
+	}
+
+	if (countPosition != NULL)
+	{
+		appendBinary(countPosition, count);
+	}
+
+	FILE* file = fopen(exporter->fileName, exporter->format == PLAN_FORMAT_BINARY ? "wb" : "w");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// sem buffer do ficheiro, para que o contedo seja escrito diretamente de uma s vez
+	setvbuf(file, NULL, _IONBF, 0);
+
+	size_t size = (size_t)(cursor - exporter->buffer);
+	bool written = fwrite(exporter->buffer, 1, size, file) == size;
+
+	// o fecho tambm tem de funcionar, para garantir que os dados foram escritos
+	written = fclose(file) == 0 && written;
+
+	return written;
+}
+
+
+/**
+ * @brief	Libertar a memria de um exportador de planos
+ * @param	exporter	Apontador para o exportador
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanPlanExporter(PlanExporter** exporter)
+{
+	if (exporter == NULL || *exporter == NULL)
+	{
+		return false;
+	}
+
+	free((*exporter)->buffer);
+	free(*exporter);
+	*exporter = NULL;
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
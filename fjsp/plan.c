@@ -485,4 +485,29 @@ bool exportPlan(char fileName[], FileCell* head)
 	return true;
 }
 
+
+/**
+ * @brief	Limpar a lista de clulas do plano da memria
+ * @param	head	Apontador para a lista de clulas
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanFileCells(FileCell* head[])
+{
+	if (head == NULL || *head == NULL)
+	{
+		return false;
+	}
+
+	FileCell* current;
+
+	while (*head != NULL)
+	{
+		current = *head;
+		*head = (*head)->next;
+		free(current);
+	}
+
+	return true;
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,601 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas ao portflio de algoritmos de escalonamento executados em paralelo.
+ * @file	portfolio.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+#pragma region portflio de algoritmos em paralelo
+
+/**
+ * @brief	Melhor plano partilhado entre todas as threads do portflio
+ *
+ * O tempo total  lido sem bloqueio (operao atmica), para que cada thread possa descartar planos piores;
+ * o plano em si s  copiado com o mutex bloqueado.
+*/
+typedef struct SharedIncumbent
+{
+	volatile int makespan;
+	Schedule* schedule;
+	Mutex lock;
+	IncumbentCallback callback;
+	void* context;
+} SharedIncumbent;
+
+
+/**
+ * @brief	Dados de cada thread do portflio
+*/
+typedef struct PortfolioWorker
+{
+	Instance* instance; // partilhada e apenas de leitura
+	SharedIncumbent* shared;
+	SolverEngine engine;
+	unsigned long long seed;
+	long long deadline;
+	int* tails; // trabalho mnimo depois de cada operao (partilhado e apenas de leitura)
+	DecodeStatistics statistics; // construes aleatorizadas desta thread
+} PortfolioWorker;
+
+
+/**
+ * @brief	Sincronizao das pocas do modo paralelo reprodutvel
+ *
+ * As threads so criadas uma vez e, entre pocas, esperam que a thread principal avance o nmero da poca.
+ * A thread principal espera que todas terminem a poca antes de trocar os planos.
+*/
+typedef struct EpochControl
+{
+	Mutex lock;
+	Condition started; // nova poca (ou fim da procura)
+	Condition finished; // todas as threads terminaram a poca
+	int epoch; // nmero da poca atual
+	int pending; // quantidade de threads que ainda no terminaram a poca atual
+	bool stop; // fim da procura
+} EpochControl;
+
+
+/**
+ * @brief	Dados de cada thread do modo paralelo reprodutvel
+ *
+ * Cada thread tem o seu prprio gerador baseado num contador, e s troca planos com as outras no fim de cada poca.
+*/
+typedef struct DeterministicWorker
+{
+	Instance* instance; // partilhada e apenas de leitura
+	SolverEngine engine;
+	Random random;
+	Schedule* local; // melhor plano da thread
+	Schedule* candidate; // memria auxiliar para as reconstrues aleatorizadas
+	int iterations; // quantidade de iteraes por poca
+	int cutoff; // tempo total do melhor plano no incio da poca
+	int* tails; // trabalho mnimo depois de cada operao (partilhado e apenas de leitura)
+	EpochControl* control; // partilhado entre as threads
+} DeterministicWorker;
+
+
+/**
+ * @brief	Publicar um plano no melhor plano partilhado, se for melhor do que o atual
+ * @param	shared		Melhor plano partilhado
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano candidato
+ * @return	Booleano para o resultado da funo (se o plano foi publicado ou no)
+*/
+static bool publishIncumbent(SharedIncumbent* shared, Instance* instance, Schedule* schedule)
+{
+	if (schedule->makespan < 0 || schedule->makespan >= loadAtomic(&shared->makespan)) // verificao rpida sem bloqueio
+	{
+		return false;
+	}
+
+	bool published = false;
+
+	lockMutex(&shared->lock);
+
+	if (schedule->makespan < shared->schedule->makespan)
+	{
+		copySchedule(shared->schedule, schedule);
+		storeAtomic(&shared->makespan, schedule->makespan);
+
+		if (shared->callback != NULL)
+		{
+			shared->callback(instance, shared->schedule, shared->context);
+		}
+
+		published = true;
+	}
+
+	unlockMutex(&shared->lock);
+
+	return published;
+}
+
+
+/**
+ * @brief	Funo chamada pelo iterated greedy de cada thread quando encontra um plano melhor
+ * @param	instance	Instncia do problema
+ * @param	incumbent	Novo melhor plano da thread
+ * @param	context		Dados da thread
+ * @return	Booleano para continuar a procura (sempre true)
+*/
+static bool publishFromWorker(Instance* instance, Schedule* incumbent, void* context)
+{
+	PortfolioWorker* worker = (PortfolioWorker*)context;
+
+	publishIncumbent(worker->shared, instance, incumbent);
+
+	return true;
+}
+
+
+/**
+ * @brief	Executar um algoritmo do portflio at ao prazo
+ *
+ * As threads de iterated greedy continuam a mesma procura (memria tabu e memria auxiliar) em intervalos de PORTFOLIO_SLICE_TIME,
+ * abandonam as reconstrues pelo tempo total do melhor plano partilhado e, no fim de cada intervalo, continuam a partir dele
+ * se o seu for pior. A regra gulosa aleatorizada abandona cada construo logo que o fim de uma operao mais o trabalho mnimo
+ * que falta ao seu trabalho chega ao tempo total do melhor plano partilhado.
+ * @param	argument	Dados da thread
+*/
+static void runPortfolioWorker(void* argument)
+{
+	PortfolioWorker* worker = (PortfolioWorker*)argument;
+	SharedIncumbent* shared = worker->shared;
+	Instance* instance = worker->instance;
+
+	Schedule* local = newSchedule(instance);
+	if (local == NULL)
+	{
+		return;
+	}
+
+	lockMutex(&shared->lock);
+	copySchedule(local, shared->schedule);
+	unlockMutex(&shared->lock);
+
+	Random random = newRandom(worker->seed);
+
+	// uma procura por thread de iterated greedy, continuada em todos os intervalos
+	IteratedGreedySearch* search = NULL;
+	if (worker->engine == ENGINE_ITERATED_GREEDY_LARGE)
+	{
+		search = startIteratedGreedy(instance, local, ITERATED_GREEDY_DESTROY_SIZE * 2, ITERATED_GREEDY_TEMPERATURE * 2.5f, nextRandom(&random));
+	}
+	else if (worker->engine != ENGINE_RANDOMIZED_GREEDY)
+	{
+		search = startIteratedGreedy(instance, local, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, nextRandom(&random));
+	}
+
+	while (getCurrentTime() < worker->deadline)
+	{
+		if (worker->engine == ENGINE_RANDOMIZED_GREEDY)
+		{
+			if (buildSchedule_Randomized(instance, local, &random, loadAtomic(&shared->makespan), worker->tails, &worker->statistics) >= 0)
+			{
+				publishIncumbent(shared, instance, local);
+			}
+
+			continue;
+		}
+
+		if (search == NULL)
+		{
+			break;
+		}
+
+		long long sliceEnd = getCurrentTime() + PORTFOLIO_SLICE_TIME;
+		if (sliceEnd > worker->deadline)
+		{
+			sliceEnd = worker->deadline;
+		}
+
+		continueIteratedGreedy(search, local, sliceEnd, 0, &shared->makespan, worker->tails, publishFromWorker, worker);
+
+		// continuar a partir do melhor plano partilhado, se for melhor do que o desta thread
+		if (local->makespan > loadAtomic(&shared->makespan))
+		{
+			lockMutex(&shared->lock);
+			copySchedule(local, shared->schedule);
+			unlockMutex(&shared->lock);
+
+			restartIteratedGreedy(search, local);
+		}
+	}
+
+	cleanIteratedGreedy(&search);
+	cleanSchedule(&local);
+}
+
+
+/**
+ * @brief	Resolver o escalonamento com um portflio de algoritmos em paralelo, at um instante limite
+ *
+ * A thread i executa o algoritmo i % NUMBER_OF_ENGINES com uma semente prpria, pelo que com mais threads do que algoritmos
+ * so executadas vrias sementes do mesmo algoritmo. Todas partilham a mesma instncia (apenas de leitura) e o melhor plano.
+ * @param	instance			Instncia do problema
+ * @param	best				Plano onde  guardado o melhor plano encontrado
+ * @param	numberOfThreads		Quantidade de threads (0 para usar todos os processadores)
+ * @param	deadline			Instante (de getCurrentTime) em que a procura termina
+ * @param	callback			Funo chamada com cada novo melhor plano (ou NULL), uma chamada de cada vez
+ * @param	context				Dados passados  funo callback
+ * @param	seed				Semente do gerador de nmeros pseudo-aleatrios
+ * @param	statistics			Estatsticas onde so somadas as construes aleatorizadas de todas as threads (ou NULL)
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_Portfolio(Instance* instance, Schedule* best, int numberOfThreads, long long deadline, IncumbentCallback callback, void* context, unsigned long long seed,
+	DecodeStatistics* statistics)
+{
+	if (instance == NULL || best == NULL)
+	{
+		return -1;
+	}
+
+	if (numberOfThreads <= 0)
+	{
+		numberOfThreads = getNumberOfProcessors();
+	}
+
+	// plano inicial pela regra gulosa, para existir sempre um plano vlido
+	if (buildSchedule_Greedy(instance, best) < 0)
+	{
+		return -1;
+	}
+
+	if (callback != NULL)
+	{
+		callback(instance, best, context);
+	}
+
+	SharedIncumbent shared;
+	shared.makespan = best->makespan;
+	shared.schedule = best;
+	shared.callback = callback;
+	shared.context = context;
+
+	PortfolioWorker* workers = (PortfolioWorker*)calloc(numberOfThreads, sizeof(PortfolioWorker));
+	Thread* threads = (Thread*)malloc(numberOfThreads * sizeof(Thread));
+	bool* started = (bool*)calloc(numberOfThreads, sizeof(bool));
+	int* tails = (int*)malloc(instance->numberOfOperations * sizeof(int));
+
+	if (workers == NULL || threads == NULL || started == NULL || tails == NULL || !newMutex(&shared.lock))
+	{
+		free(workers);
+		free(threads);
+		free(started);
+		free(tails);
+		return best->makespan;
+	}
+
+	getJobTails_OfInstance(instance, tails);
+
+	for (int i = 0; i < numberOfThreads; i++)
+	{
+		workers[i].instance = instance;
+		workers[i].shared = &shared;
+		workers[i].engine = (SolverEngine)(i % NUMBER_OF_ENGINES);
+		workers[i].seed = seed + (unsigned long long)i * 0x9E3779B97F4A7C15ULL;
+		workers[i].deadline = deadline;
+		workers[i].tails = tails;
+
+		started[i] = startThread(&threads[i], runPortfolioWorker, &workers[i]);
+	}
+
+	for (int i = 0; i < numberOfThreads; i++)
+	{
+		if (started[i])
+		{
+			joinThread(threads[i]);
+			mergeDecodeStatistics(statistics, &workers[i].statistics);
+		}
+	}
+
+	cleanMutex(&shared.lock);
+	free(workers);
+	free(threads);
+	free(started);
+	free(tails);
+
+	return best->makespan;
+}
+
+/**
+ * @brief	Melhorar um plano com um dos algoritmos do portflio durante uma quantidade fixa de iteraes
+ * @param	instance	Instncia do problema
+ * @param	best		Plano avaliado, onde  guardado o melhor plano encontrado
+ * @param	candidate	Memria auxiliar para as reconstrues aleatorizadas (plano da mesma instncia)
+ * @param	engine		Algoritmo
+ * @param	iterations	Quantidade de iteraes
+ * @param	cutoff		Tempo total a partir do qual as reconstrues aleatorizadas so abandonadas (0 para usar apenas o do melhor plano)
+ * @param	tails		Trabalho mnimo depois de cada operao, de getJobTails_OfInstance (ou NULL)
+ * @param	statistics	Estatsticas onde so registadas as reconstrues aleatorizadas (ou NULL)
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel)
+*/
+int improveSchedule_Engine(Instance* instance, Schedule* best, Schedule* candidate, SolverEngine engine, int iterations, int cutoff, int* tails,
+	DecodeStatistics* statistics, Random* random)
+{
+	if (instance == NULL || best == NULL || random == NULL)
+	{
+		return -1;
+	}
+
+	if (engine == ENGINE_RANDOMIZED_GREEDY)
+	{
+		for (int i = 0; candidate != NULL && i < iterations; i++)
+		{
+			int limit = cutoff > 0 && cutoff < best->makespan ? cutoff : best->makespan;
+
+			if (buildSchedule_Randomized(instance, candidate, random, limit, tails, statistics) >= 0)
+			{
+				copySchedule(best, candidate);
+			}
+		}
+
+		return best->makespan;
+	}
+
+	if (engine == ENGINE_ITERATED_GREEDY_LARGE)
+	{
+		return improveSchedule_IteratedGreedy(instance, best, ITERATED_GREEDY_DESTROY_SIZE * 2, ITERATED_GREEDY_TEMPERATURE * 2.5f, 0,
+			iterations, nextRandom(random), NULL, NULL);
+	}
+
+	return improveSchedule_IteratedGreedy(instance, best, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, 0,
+		iterations, nextRandom(random), NULL, NULL);
+}
+
+
+/**
+ * @brief	Executar uma poca de um algoritmo no modo reprodutvel: uma quantidade fixa de iteraes, sem consultar o relgio
+ * @param	argument	Dados da thread
+*/
+static void runDeterministicEpoch(void* argument)
+{
+	DeterministicWorker* worker = (DeterministicWorker*)argument;
+
+	improveSchedule_Engine(worker->instance, worker->local, worker->candidate, worker->engine, worker->iterations, worker->cutoff, worker->tails, NULL,
+		&worker->random);
+}
+
+
+/**
+ * @brief	Executar as pocas de um algoritmo no modo reprodutvel numa thread que se mantm entre pocas
+ * @param	argument	Dados da thread
+*/
+static void runDeterministicWorker(void* argument)
+{
+	DeterministicWorker* worker = (DeterministicWorker*)argument;
+	EpochControl* control = worker->control;
+	int epoch = 0;
+
+	lockMutex(&control->lock);
+
+	while (true)
+	{
+		while (!control->stop && control->epoch == epoch)
+		{
+			waitCondition(&control->started, &control->lock);
+		}
+
+		if (control->stop)
+		{
+			break;
+		}
+
+		epoch = control->epoch;
+		unlockMutex(&control->lock);
+
+		runDeterministicEpoch(worker);
+
+		lockMutex(&control->lock);
+
+		if (--control->pending == 0)
+		{
+			broadcastCondition(&control->finished);
+		}
+	}
+
+	unlockMutex(&control->lock);
+}
+
+
+/**
+ * @brief	Resolver o escalonamento com o portflio em paralelo de forma reprodutvel
+ *
+ * A procura  dividida em pocas. As threads so criadas uma vez e sincronizadas entre pocas. Em cada poca todas as threads executam a mesma quantidade de iteraes com geradores
+ * prprios (derivados da semente e do ndice da thread) e, no fim, o melhor plano das threads (com empates resolvidos pelo
+ * menor ndice) passa a ser o melhor plano partilhado, que as threads com planos piores adotam. Como nenhuma deciso depende
+ * do relgio nem da ordem de execuo das threads, a mesma semente e a mesma quantidade de threads produzem sempre o mesmo plano.
+ * @param	instance				Instncia do problema
+ * @param	best					Plano onde  guardado o melhor plano encontrado
+ * @param	numberOfThreads			Quantidade de threads (tem de ser indicada, porque faz parte do resultado)
+ * @param	numberOfEpochs			Quantidade de pocas
+ * @param	iterationsPerEpoch		Quantidade de iteraes de cada thread em cada poca
+ * @param	deadline				Instante (de getCurrentTime) a partir do qual no so iniciadas mais pocas (0 para no limitar);
+ *									o resultado s  reprodutvel se a procura terminar pela quantidade de pocas
+ * @param	callback				Funo chamada com cada novo melhor plano (ou NULL)
+ * @param	context					Dados passados  funo callback
+ * @param	seed					Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_Deterministic(Instance* instance, Schedule* best, int numberOfThreads, int numberOfEpochs, int iterationsPerEpoch, long long deadline,
+	IncumbentCallback callback, void* context, unsigned long long seed)
+{
+	if (instance == NULL || best == NULL || numberOfThreads <= 0)
+	{
+		return -1;
+	}
+
+	if (buildSchedule_Greedy(instance, best) < 0)
+	{
+		return -1;
+	}
+
+	if (callback != NULL)
+	{
+		callback(instance, best, context);
+	}
+
+	DeterministicWorker* workers = (DeterministicWorker*)calloc(numberOfThreads, sizeof(DeterministicWorker));
+	Thread* threads = (Thread*)malloc(numberOfThreads * sizeof(Thread));
+	bool* started = (bool*)calloc(numberOfThreads, sizeof(bool));
+	int* tails = (int*)malloc(instance->numberOfOperations * sizeof(int));
+	bool allocated = workers != NULL && threads != NULL && started != NULL && tails != NULL && getJobTails_OfInstance(instance, tails);
+
+	EpochControl control;
+	control.epoch = 0;
+	control.pending = 0;
+	control.stop = false;
+
+	bool synchronized = allocated && newMutex(&control.lock);
+
+	if (synchronized && !newCondition(&control.started))
+	{
+		cleanMutex(&control.lock);
+		synchronized = false;
+	}
+
+	if (synchronized && !newCondition(&control.finished))
+	{
+		cleanCondition(&control.started);
+		cleanMutex(&control.lock);
+		synchronized = false;
+	}
+
+	for (int i = 0; allocated && i < numberOfThreads; i++)
+	{
+		workers[i].instance = instance;
+		workers[i].engine = (SolverEngine)(i % NUMBER_OF_ENGINES);
+		workers[i].random = newRandom(seed + (unsigned long long)(i + 1) * 0x9E3779B97F4A7C15ULL);
+		workers[i].local = newSchedule(instance);
+		workers[i].candidate = newSchedule(instance);
+		workers[i].iterations = iterationsPerEpoch;
+		workers[i].tails = tails;
+		workers[i].control = &control;
+
+		allocated = workers[i].local != NULL && workers[i].candidate != NULL && copySchedule(workers[i].local, best);
+	}
+
+	int numberOfStarted = 0;
+
+	for (int i = 0; allocated && synchronized && i < numberOfThreads; i++)
+	{
+		started[i] = startThread(&threads[i], runDeterministicWorker, &workers[i]);
+		numberOfStarted += started[i];
+	}
+
+	for (int epoch = 0; allocated && epoch < numberOfEpochs; epoch++)
+	{
+		if (deadline > 0 && getCurrentTime() >= deadline)
+		{
+			break;
+		}
+
+		for (int i = 0; i < numberOfThreads; i++)
+		{
+			workers[i].cutoff = best->makespan;
+		}
+
+		if (numberOfStarted > 0)
+		{
+			lockMutex(&control.lock);
+			control.pending = numberOfStarted;
+			control.epoch++;
+			broadcastCondition(&control.started);
+			unlockMutex(&control.lock);
+		}
+
+		for (int i = 0; i < numberOfThreads; i++)
+		{
+			if (!started[i])
+			{
+				runDeterministicEpoch(&workers[i]); // sem thread, a poca  executada nesta thread com o mesmo resultado
+			}
+		}
+
+		if (numberOfStarted > 0)
+		{
+			lockMutex(&control.lock);
+
+			while (control.pending > 0)
+			{
+				waitCondition(&control.finished, &control.lock);
+			}
+
+			unlockMutex(&control.lock);
+		}
+
+		// troca de planos no fim da poca, sempre pela mesma ordem
+		int winner = -1;
+		for (int i = 0; i < numberOfThreads; i++)
+		{
+			if (workers[i].local->makespan >= 0 && workers[i].local->makespan < best->makespan
+				&& (winner == -1 || workers[i].local->makespan < workers[winner].local->makespan))
+			{
+				winner = i;
+			}
+		}
+
+		if (winner != -1)
+		{
+			copySchedule(best, workers[winner].local);
+
+			if (callback != NULL)
+			{
+				callback(instance, best, context);
+			}
+		}
+
+		for (int i = 0; i < numberOfThreads; i++)
+		{
+			if (workers[i].local->makespan > best->makespan)
+			{
+				copySchedule(workers[i].local, best);
+			}
+		}
+	}
+
+	if (synchronized)
+	{
+		lockMutex(&control.lock);
+		control.stop = true;
+		broadcastCondition(&control.started);
+		unlockMutex(&control.lock);
+
+		for (int i = 0; i < numberOfThreads; i++)
+		{
+			if (started[i])
+			{
+				joinThread(threads[i]);
+			}
+		}
+
+		cleanCondition(&control.finished);
+		cleanCondition(&control.started);
+		cleanMutex(&control.lock);
+	}
+
+	for (int i = 0; workers != NULL && i < numberOfThreads; i++)
+	{
+		cleanSchedule(&workers[i].local);
+		cleanSchedule(&workers[i].candidate);
+	}
+
+	free(workers);
+	free(threads);
+	free(started);
+	free(tails);
+
+	return best->makespan;
+}
+
+#pragma endregion
\ No newline at end of file
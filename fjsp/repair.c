@@ -0,0 +1,653 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas  reparao incremental de planos quando os dados mudam.
+ * @file	repair.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Elemento da fila de prioridade usada para propagar os tempos por ordem topolgica
+*/
+typedef struct PropagationEntry
+{
+	int key; // tempo inicial da operao antes da propagao
+	int operation;
+} PropagationEntry;
+
+
+/**
+ * @brief	Fila de prioridade (min-heap) de operaes a propagar
+*/
+typedef struct PropagationQueue
+{
+	PropagationEntry* entries;
+	int size;
+	int capacity;
+} PropagationQueue;
+
+
+#pragma region fila de propagao
+
+/**
+ * @brief	Inserir uma operao na fila de propagao
+ * @param	queue		Fila
+ * @param	key			Chave de ordenao
+ * @param	operation	ndice da operao
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool pushOperation_AtQueue(PropagationQueue* queue, int key, int operation)
+{
+	if (queue->size == queue->capacity)
+	{
+		int capacity = queue->capacity == 0 ? 16 : queue->capacity * 2;
+		PropagationEntry* entries = (PropagationEntry*)realloc(queue->entries, capacity * sizeof(PropagationEntry));
+		if (entries == NULL) // se no houver memria para alocar
+		{
+			return false;
+		}
+
+		queue->entries = entries;
+		queue->capacity = capacity;
+	}
+
+	int i = queue->size++;
+
+	while (i > 0)
+	{
+		int parent = (i - 1) / 2;
+
+		if (queue->entries[parent].key <= key)
+		{
+			break;
+		}
+
+		queue->entries[i] = queue->entries[parent];
+		i = parent;
+	}
+
+	queue->entries[i].key = key;
+	queue->entries[i].operation = operation;
+
+	return true;
+}
+
+
+/**
+ * @brief	Retirar da fila de propagao a operao com menor chave
+ * @param	queue	Fila (no pode estar vazia)
+ * @return	ndice da operao
+*/
+static int popOperation_AtQueue(PropagationQueue* queue)
+{
+	int operation = queue->entries[0].operation;
+	PropagationEntry last = queue->entries[--queue->size];
+	int i = 0;
+
+	while (true)
+	{
+		int child = 2 * i + 1;
+
+		if (child >= queue->size)
+		{
+			break;
+		}
+
+		if (child + 1 < queue->size && queue->entries[child + 1].key < queue->entries[child].key)
+		{
+			child++;
+		}
+
+		if (last.key <= queue->entries[child].key)
+		{
+			break;
+		}
+
+		queue->entries[i] = queue->entries[child];
+		i = child;
+	}
+
+	if (queue->size > 0)
+	{
+		queue->entries[i] = last;
+	}
+
+	return operation;
+}
+
+#pragma endregion
+
+
+#pragma region reparao de planos
+
+/**
+ * @brief	Propagar os tempos de um plano a partir de uma operao cujo tempo de execuo (ou predecessores) mudou
+ *
+ * Apenas as operaes a jusante da operao indicada so visitadas. So processadas por ordem do tempo inicial
+ * anterior  alterao, que  uma ordem topolgica do grafo (com tempos de execuo positivos, cada operao comea depois
+ * do incio dos seus predecessores), pelo que cada operao afetada  normalmente recalculada uma nica vez.
+ * A atribuio de mquinas e as sequncias no mudam, logo a ordem topolgica guardada no plano continua vlida
+ * e as caudas podem ser obtidas de novo com getTails_OfSchedule.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano j avaliado
+ * @param	operation	ndice da operao alterada
+ * @param	affected	Array onde so guardadas as operaes cujos tempos mudaram (ou NULL), com tamanho igual  quantidade de operaes
+ * @return	Quantidade de operaes cujos tempos mudaram (ou -1 se no foi possvel)
+*/
+int propagateTimes_AtSchedule(Instance* instance, Schedule* schedule, int operation, int* affected)
+{
+	if (instance == NULL || schedule == NULL || schedule->makespan < 0 || schedule->assignedMachine[operation] == -1)
+	{
+		return -1;
+	}
+
+	PropagationQueue queue = { NULL, 0, 0 };
+	int numberOfAffected = 0;
+	bool first = true;
+
+	if (!pushOperation_AtQueue(&queue, schedule->startTime[operation], operation))
+	{
+		return -1;
+	}
+
+	while (queue.size > 0)
+	{
+		int o = popOperation_AtQueue(&queue);
+		int previousJob = schedule->previousInJob[o];
+		int previousMachine = schedule->previousInMachine[o];
+		int start = schedule->releaseTime[o];
+
+		if (previousJob != -1 && schedule->endTime[previousJob] > start)
+		{
+			start = schedule->endTime[previousJob];
+		}
+
+		if (previousMachine != -1 && schedule->endTime[previousMachine] > start)
+		{
+			start = schedule->endTime[previousMachine];
+		}
+		else if (previousMachine == -1 && schedule->machineReleaseTime[schedule->assignedMachine[o]] > start)
+		{
+			start = schedule->machineReleaseTime[schedule->assignedMachine[o]];
+		}
+
+		int end = start + schedule->assignedRuntime[o];
+
+		// uma operao pode entrar na fila pelos dois predecessores, mas s  propagada se os seus tempos mudarem
+		if (!first && start == schedule->startTime[o] && end == schedule->endTime[o])
+		{
+			continue;
+		}
+
+		first = false;
+		bool changed = start != schedule->startTime[o] || end != schedule->endTime[o];
+
+		schedule->startTime[o] = start;
+		schedule->endTime[o] = end;
+
+		if (changed && affected != NULL && numberOfAffected < schedule->numberOfOperations)
+		{
+			affected[numberOfAffected] = o;
+		}
+		numberOfAffected += changed;
+
+		int successors[2] = { schedule->nextInJob[o], schedule->nextInMachine[o] };
+
+		for (int i = 0; i < 2; i++)
+		{
+			if (successors[i] != -1 && !pushOperation_AtQueue(&queue, schedule->startTime[successors[i]], successors[i]))
+			{
+				free(queue.entries);
+				return -1;
+			}
+		}
+	}
+
+	free(queue.entries);
+
+	// o tempo total  o maior tempo final das ltimas operaes de cada mquina
+	int makespan = 0;
+	for (int m = 0; m < schedule->numberOfMachines; m++)
+	{
+		int last = schedule->lastInMachine[m];
+
+		if (last != -1 && schedule->endTime[last] > makespan)
+		{
+			makespan = schedule->endTime[last];
+		}
+	}
+
+	schedule->makespan = makespan;
+
+	return numberOfAffected;
+}
+
+
+/**
+ * @brief	Propagar as caudas de um plano a partir de uma operao cujos sucessores (ou tempo de execuo) mudaram
+ *
+ * Apenas as operaes a montante da operao indicada so visitadas, por ordem decrescente do tempo inicial
+ * (os tempos iniciais tm de estar atualizados), que  uma ordem topolgica inversa do grafo.
+ * @param	schedule	Plano
+ * @param	operation	ndice da operao alterada
+ * @param	tails		Caudas das operaes escalonadas, atualizadas pela funo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool propagateTails_AtSchedule(Schedule* schedule, int operation, int* tails)
+{
+	PropagationQueue queue = { NULL, 0, 0 };
+	bool first = true;
+
+	// a fila devolve a menor chave, por isso a chave  o tempo inicial com sinal trocado
+	if (!pushOperation_AtQueue(&queue, -schedule->startTime[operation], operation))
+	{
+		return false;
+	}
+
+	while (queue.size > 0)
+	{
+		int o = popOperation_AtQueue(&queue);
+		int nextJob = schedule->nextInJob[o];
+		int nextMachine = schedule->nextInMachine[o];
+		int tail = 0;
+
+		if (nextJob != -1 && tails[nextJob] > tail)
+		{
+			tail = tails[nextJob];
+		}
+
+		if (nextMachine != -1 && tails[nextMachine] > tail)
+		{
+			tail = tails[nextMachine];
+		}
+
+		tail += schedule->assignedRuntime[o];
+
+		if (!first && tail == tails[o])
+		{
+			continue;
+		}
+
+		first = false;
+		tails[o] = tail;
+
+		int predecessors[2] = { schedule->previousInJob[o], schedule->previousInMachine[o] };
+
+		for (int i = 0; i < 2; i++)
+		{
+			if (predecessors[i] != -1 && !pushOperation_AtQueue(&queue, -schedule->startTime[predecessors[i]], predecessors[i]))
+			{
+				free(queue.entries);
+				return false;
+			}
+		}
+	}
+
+	free(queue.entries);
+
+	return true;
+}
+
+
+/**
+ * @brief	Retirar uma operao da sua mquina, atualizando as cabeas a jusante e as caudas a montante
+ *
+ * A operao continua na sequncia do trabalho, mas sem durao, para que o sucessor no trabalho passe a depender
+ * apenas do predecessor no trabalho.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano com as cabeas atualizadas
+ * @param	operation	ndice da operao
+ * @param	tails		Caudas das operaes escalonadas, atualizadas pela funo
+ * @return	Booleano para o resultado da funo (se os tempos foram atualizados; a operao  sempre retirada)
+*/
+static bool detachOperation_AtSchedule(Instance* instance, Schedule* schedule, int operation, int* tails)
+{
+	int previous = schedule->previousInMachine[operation];
+	int next = schedule->nextInMachine[operation];
+	int jobPrevious = schedule->previousInJob[operation];
+	int jobNext = schedule->nextInJob[operation];
+	int head = schedule->releaseTime[operation];
+
+	if (jobPrevious != -1 && schedule->endTime[jobPrevious] > head)
+	{
+		head = schedule->endTime[jobPrevious];
+	}
+
+	removeOperation_AtSchedule(schedule, operation);
+
+	schedule->assignedRuntime[operation] = 0;
+	schedule->startTime[operation] = head;
+	schedule->endTime[operation] = head;
+
+	bool propagated = (jobNext == -1 || propagateTimes_AtSchedule(instance, schedule, jobNext, NULL) >= 0)
+		&& (next == -1 || propagateTimes_AtSchedule(instance, schedule, next, NULL) >= 0);
+
+	return propagated && propagateTails_AtSchedule(schedule, operation, tails)
+		&& (previous == -1 || propagateTails_AtSchedule(schedule, previous, tails));
+}
+
+
+/**
+ * @brief	Colocar uma operao retirada numa posio de uma mquina, atualizando as cabeas a jusante e as caudas a montante
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano com as cabeas atualizadas
+ * @param	operation	ndice da operao
+ * @param	machine		ndice da mquina
+ * @param	runtime		Tempo de execuo da operao na mquina
+ * @param	previous	Operao anterior na mquina (ou -1 para ficar em primeiro)
+ * @param	tails		Caudas das operaes escalonadas, atualizadas pela funo
+ * @return	Booleano para o resultado da funo (se os tempos foram atualizados; a operao  sempre colocada)
+*/
+static bool attachOperation_AtSchedule(Instance* instance, Schedule* schedule, int operation, int machine, int runtime, int previous, int* tails)
+{
+	insertOperation_AtSchedule(schedule, operation, machine, runtime, previous);
+
+	return propagateTimes_AtSchedule(instance, schedule, operation, NULL) >= 0 && propagateTails_AtSchedule(schedule, operation, tails);
+}
+
+
+/**
+ * @brief	Polir uma regio de um plano: cada operao da regio  retirada e reinserida na melhor posio,
+ *			mantendo a alterao apenas se o tempo total no piorar
+ *
+ * As caudas so calculadas uma vez. Depois, retirar e reinserir cada operao s propaga os tempos a partir dela
+ * (cabeas a jusante e caudas a montante), e cada posio candidata  avaliada pela cabea e pela cauda dos vizinhos.
+ * Essa avaliao  o caminho mais longo que passa pela operao, logo o tempo total s no piora se no for maior
+ * do que o anterior, sem ser preciso avaliar o plano. No fim, se o plano mudou,  avaliado uma vez para atualizar a ordem topolgica.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano j avaliado
+ * @param	region		ndices das operaes a reinserir
+ * @param	regionSize	Quantidade de operaes da regio
+ * @return	Tempo total do plano (ou -1 se no foi possvel)
+*/
+int polishSchedule_Region(Instance* instance, Schedule* schedule, int* region, int regionSize)
+{
+	if (instance == NULL || schedule == NULL || region == NULL || schedule->makespan < 0)
+	{
+		return -1;
+	}
+
+	int* tails = (int*)malloc(instance->numberOfOperations * sizeof(int));
+
+	if (tails == NULL || !getTails_OfSchedule(schedule, tails))
+	{
+		free(tails);
+		return schedule->makespan;
+	}
+
+	bool changed = false;
+	bool propagated = true;
+
+	for (int i = 0; i < regionSize && propagated; i++)
+	{
+		int operation = region[i];
+		int machine = schedule->assignedMachine[operation];
+		int runtime = schedule->assignedRuntime[operation];
+		int previous = schedule->previousInMachine[operation];
+		int makespan = schedule->makespan;
+
+		if (machine == -1)
+		{
+			continue;
+		}
+
+		propagated = detachOperation_AtSchedule(instance, schedule, operation, tails);
+
+		int bestMachine, bestRuntime, bestPrevious;
+		int cost = propagated ? getBestPosition_ForOperation(instance, schedule, operation, 0, tails, &bestMachine, &bestRuntime, &bestPrevious) : -1;
+
+		if (cost >= 0 && cost <= makespan)
+		{
+			changed = changed || bestMachine != machine || bestPrevious != previous;
+			machine = bestMachine;
+			runtime = bestRuntime;
+			previous = bestPrevious;
+		}
+
+		propagated = attachOperation_AtSchedule(instance, schedule, operation, machine, runtime, previous, tails) && propagated;
+	}
+
+	free(tails);
+
+	// sem memria para propagar, os tempos so recalculados a partir da atribuio e das sequncias
+	if (changed || !propagated)
+	{
+		return evaluateSchedule(instance, schedule);
+	}
+
+	return schedule->makespan;
+}
+
+
+/**
+ * @brief	Reparar um plano depois de alterar o tempo de execuo de uma operao numa mquina
+ *
+ * A instncia  atualizada com o novo tempo. Se a operao estiver escalonada nessa mquina, a atribuio e as sequncias
+ * mantm-se e apenas os tempos a jusante da operao so recalculados. Opcionalmente, as operaes afetadas
+ * (at REPAIR_POLISH_SIZE, a comear pela alterada) so reinseridas na melhor posio.
+ * @param	instance		Instncia do problema
+ * @param	schedule		Plano j avaliado
+ * @param	operationID		Identificador da operao
+ * @param	machineID		Identificador da mquina
+ * @param	runtime			Novo tempo de execuo
+ * @param	polish			Se as operaes afetadas devem ser reinseridas na melhor posio
+ * @return	Tempo total do plano reparado (ou -1 se no foi possvel)
+*/
+int repairSchedule_Runtime(Instance* instance, Schedule* schedule, int operationID, int machineID, int runtime, bool polish)
+{
+	if (instance == NULL || schedule == NULL || runtime <= 0)
+	{
+		return -1;
+	}
+
+	int operation = getOperationIndex_AtInstance(instance, operationID);
+	int machine = getMachineIndex_AtInstance(instance, machineID);
+
+	if (operation == -1 || machine == -1 || !setRuntime_AtInstance(instance, operation, machine, runtime))
+	{
+		return -1;
+	}
+
+	if (schedule->assignedMachine[operation] != machine) // o plano no usa esta execuo, logo no muda
+	{
+		return schedule->makespan;
+	}
+
+	schedule->assignedRuntime[operation] = runtime;
+
+	int* affected = (int*)malloc(instance->numberOfOperations * sizeof(int));
+	if (affected == NULL) // se no houver memria para alocar
+	{
+		return evaluateSchedule(instance, schedule);
+	}
+
+	int numberOfAffected = propagateTimes_AtSchedule(instance, schedule, operation, affected);
+
+	if (numberOfAffected < 0)
+	{
+		free(affected);
+		return evaluateSchedule(instance, schedule);
+	}
+
+	if (polish)
+	{
+		// a operao alterada  sempre a primeira a ser processada
+		if (numberOfAffected == 0)
+		{
+			affected[numberOfAffected++] = operation;
+		}
+
+		polishSchedule_Region(instance, schedule, affected, numberOfAffected < REPAIR_POLISH_SIZE ? numberOfAffected : REPAIR_POLISH_SIZE);
+	}
+
+	free(affected);
+
+	return schedule->makespan;
+}
+
+
+/**
+ * @brief	Reparar um plano depois de uma mquina avariar ou ser removida
+ *
+ * Apenas as operaes da mquina que ainda no terminaram no instante da avaria so reatribudas, uma a uma e pela
+ * ordem em que estavam na mquina, ao melhor intervalo das restantes mquinas elegveis (insero em intervalos).
+ * As restantes operaes mantm a mquina e a sequncia e s podem ser adiadas: nenhuma comea antes do que estava
+ * planeado e as operaes reatribudas no comeam antes da avaria nem antes de operaes que j tinham comeado.
+ * No fim, os tempos mnimos de incio voltam a ser os originais (nas operaes reatribudas, nunca antes da avaria).
+ * @param	instance		Instncia do problema (a mquina deixa de ser elegvel, apenas se a reparao funcionou)
+ * @param	schedule		Plano j avaliado
+ * @param	machineID		Identificador da mquina removida
+ * @param	failureTime		Instante da avaria (0 para reatribuir todas as operaes da mquina)
+ * @return	Tempo total do plano reparado (ou -1 se no foi possvel, ficando o plano como estava)
+*/
+int repairSchedule_MachineRemoval(Instance* instance, Schedule* schedule, int machineID, int failureTime)
+{
+	if (instance == NULL || schedule == NULL || schedule->makespan < 0)
+	{
+		return -1;
+	}
+
+	int machine = getMachineIndex_AtInstance(instance, machineID);
+	if (machine == -1)
+	{
+		return -1;
+	}
+
+	if (failureTime < 0)
+	{
+		failureTime = 0;
+	}
+
+	Schedule* backup = newSchedule(instance);
+	int* displaced = (int*)malloc(instance->numberOfOperations * sizeof(int));
+	int* tails = (int*)malloc(instance->numberOfOperations * sizeof(int));
+
+	// mquinas elegveis originais, repostas na instncia se a reparao falhar
+	int numberOfExecutions = instance->numberOfExecutions;
+	int* eligibleStart = (int*)malloc((instance->numberOfOperations + 1) * sizeof(int));
+	int* eligibleMachines = (int*)malloc((numberOfExecutions + 1) * sizeof(int));
+	int* eligibleRuntimes = (int*)malloc((numberOfExecutions + 1) * sizeof(int));
+
+	if (backup == NULL || displaced == NULL || tails == NULL || eligibleStart == NULL || eligibleMachines == NULL || eligibleRuntimes == NULL)
+	{
+		cleanSchedule(&backup);
+		free(displaced);
+		free(tails);
+		free(eligibleStart);
+		free(eligibleMachines);
+		free(eligibleRuntimes);
+		return -1;
+	}
+
+	// operaes da mquina que no terminaram antes da avaria, pela ordem da sequncia
+	int numberOfDisplaced = 0;
+	bool possible = true;
+
+	for (int o = schedule->firstInMachine[machine]; o != -1 && possible; o = schedule->nextInMachine[o])
+	{
+		if (schedule->endTime[o] <= failureTime)
+		{
+			continue;
+		}
+
+		displaced[numberOfDisplaced++] = o;
+
+		// tem de existir outra mquina elegvel
+		possible = false;
+		for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+		{
+			if (instance->eligibleMachines[k] != machine)
+			{
+				possible = true;
+			}
+		}
+	}
+
+	if (!possible)
+	{
+		cleanSchedule(&backup);
+		free(displaced);
+		free(tails);
+		free(eligibleStart);
+		free(eligibleMachines);
+		free(eligibleRuntimes);
+		return -1;
+	}
+
+	copySchedule(backup, schedule);
+	memcpy(eligibleStart, instance->eligibleStart, (instance->numberOfOperations + 1) * sizeof(int));
+	memcpy(eligibleMachines, instance->eligibleMachines, numberOfExecutions * sizeof(int));
+	memcpy(eligibleRuntimes, instance->eligibleRuntimes, numberOfExecutions * sizeof(int));
+
+	// nenhuma operao pode comear antes do que estava planeado (deslocar apenas para a direita)
+	for (int o = 0; o < schedule->numberOfOperations; o++)
+	{
+		if (schedule->assignedMachine[o] != -1)
+		{
+			schedule->releaseTime[o] = schedule->startTime[o];
+		}
+	}
+
+	for (int i = 0; i < numberOfDisplaced; i++)
+	{
+		removeOperation_AtSchedule(schedule, displaced[i]);
+		schedule->releaseTime[displaced[i]] = backup->releaseTime[displaced[i]] > failureTime ? backup->releaseTime[displaced[i]] : failureTime;
+	}
+
+	removeMachine_AtInstance(instance, machine);
+
+	// as operaes que j comearam antes da avaria ficam fixas, por isso s se pode inserir depois delas
+	int makespan = 0;
+	for (int i = 0; i < numberOfDisplaced && makespan >= 0; i++)
+	{
+		makespan = reinsertOperation_AtBestPosition(instance, schedule, displaced[i], failureTime, tails);
+	}
+
+	if (numberOfDisplaced == 0)
+	{
+		makespan = evaluateSchedule(instance, schedule);
+	}
+
+	if (makespan < 0) // o plano e a instncia voltam a corresponder um ao outro
+	{
+		copySchedule(schedule, backup);
+		memcpy(instance->eligibleStart, eligibleStart, (instance->numberOfOperations + 1) * sizeof(int));
+		memcpy(instance->eligibleMachines, eligibleMachines, numberOfExecutions * sizeof(int));
+		memcpy(instance->eligibleRuntimes, eligibleRuntimes, numberOfExecutions * sizeof(int));
+		instance->numberOfExecutions = numberOfExecutions;
+	}
+	else // os tempos calculados mantm-se, mas deixam de estar presos aos tempos iniciais anteriores
+	{
+		for (int o = 0; o < schedule->numberOfOperations; o++)
+		{
+			schedule->releaseTime[o] = backup->releaseTime[o];
+		}
+
+		for (int i = 0; i < numberOfDisplaced; i++)
+		{
+			if (schedule->releaseTime[displaced[i]] < failureTime)
+			{
+				schedule->releaseTime[displaced[i]] = failureTime;
+			}
+		}
+	}
+
+	cleanSchedule(&backup);
+	free(displaced);
+	free(tails);
+	free(eligibleStart);
+	free(eligibleMachines);
+	free(eligibleRuntimes);
+
+	return makespan;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,527 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas  decomposio do escalonamento por horizonte deslizante (janelas de operaes).
+ * @file	rolling.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "concurrency.h"
+#include "utils.h"
+
+
+/**
+ * @brief	Operao com um tempo, para ordenar operaes pelo tempo inicial
+*/
+typedef struct TimedOperation
+{
+	int time;
+	int operation;
+} TimedOperation;
+
+
+/**
+ * @brief	Janela do horizonte deslizante: instncia s com as operaes da janela e o respetivo plano
+*/
+typedef struct HorizonWindow
+{
+	Instance* instance;
+	Schedule* schedule;
+	int* globalIndex; // ndice na instncia completa de cada operao da janela
+} HorizonWindow;
+
+
+/**
+ * @brief	Dados do polimento de uma janela j fixada, executado em paralelo com a janela seguinte
+*/
+typedef struct HorizonPolish
+{
+	HorizonWindow window; // apenas as operaes fixadas da janela
+	int* machineFrontier; // fim da ltima operao de cada mquina antes do polimento
+	int* jobFrontier; // fim da ltima operao de cada trabalho antes do polimento
+	int iterations;
+	Random random;
+	bool improved; // se o plano polido pode substituir o anterior
+} HorizonPolish;
+
+
+#pragma region janelas
+
+/**
+ * @brief	Comparar duas operaes pelo tempo (e pelo ndice, para a ordem ser sempre a mesma)
+ * @param	a	Primeira operao
+ * @param	b	Segunda operao
+ * @return	Valor negativo, zero ou positivo
+*/
+static int compareTimedOperations(const void* a, const void* b)
+{
+	const TimedOperation* first = (const TimedOperation*)a;
+	const TimedOperation* second = (const TimedOperation*)b;
+
+	if (first->time != second->time)
+	{
+		return first->time < second->time ? -1 : 1;
+	}
+
+	return (first->operation > second->operation) - (first->operation < second->operation);
+}
+
+
+/**
+ * @brief	Comparar dois inteiros
+ * @param	a	Primeiro inteiro
+ * @param	b	Segundo inteiro
+ * @return	Valor negativo, zero ou positivo
+*/
+static int compareOperations(const void* a, const void* b)
+{
+	int first = *(const int*)a;
+	int second = *(const int*)b;
+
+	return (first > second) - (first < second);
+}
+
+
+/**
+ * @brief	Limpar uma janela da memria
+ * @param	window	Janela
+*/
+static void cleanWindow(HorizonWindow* window)
+{
+	cleanSchedule(&window->schedule);
+	cleanInstance(&window->instance);
+	free(window->globalIndex);
+	window->globalIndex = NULL;
+}
+
+
+/**
+ * @brief	Criar a janela de um conjunto de operaes, com as decises j fixadas no plano completo como tempos mnimos de incio
+ * @param	instance	Instncia completa
+ * @param	result		Plano completo com as operaes j fixadas
+ * @param	operations	ndices das operaes da janela (so ordenados)
+ * @param	count		Quantidade de operaes
+ * @param	window		Janela a preencher
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool newWindow(Instance* instance, Schedule* result, int* operations, int count, HorizonWindow* window)
+{
+	qsort(operations, count, sizeof(int), compareOperations);
+
+	window->instance = newInstance_Subset(instance, operations, count);
+	window->schedule = newSchedule(window->instance);
+	window->globalIndex = (int*)malloc(count * sizeof(int));
+
+	if (window->instance == NULL || window->schedule == NULL || window->globalIndex == NULL)
+	{
+		cleanWindow(window);
+		return false;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		int o = operations[i];
+		window->globalIndex[i] = o;
+
+		// a operao anterior do trabalho, se j estiver fixada, define quando esta pode comear
+		if (o > instance->jobStart[instance->operationJob[o]] && result->assignedMachine[o - 1] != -1)
+		{
+			window->schedule->releaseTime[i] = result->endTime[o - 1];
+		}
+	}
+
+	// cada mquina s fica disponvel depois da ltima operao j fixada
+	for (int m = 0; m < instance->numberOfMachines; m++)
+	{
+		int last = result->lastInMachine[m];
+		window->schedule->machineReleaseTime[m] = last == -1 ? result->machineReleaseTime[m] : result->endTime[last];
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Acrescentar ao fim das mquinas do plano completo operaes de uma janela, pela ordem do tempo inicial
+ * @param	result		Plano completo
+ * @param	window		Janela
+ * @param	sorted		Operaes da janela ordenadas pelo tempo inicial
+ * @param	count		Quantidade de operaes a acrescentar
+*/
+static void commitWindow(Schedule* result, HorizonWindow* window, TimedOperation* sorted, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		int local = sorted[i].operation;
+		int o = window->globalIndex[local];
+		int machine = window->schedule->assignedMachine[local];
+
+		insertOperation_AtSchedule(result, o, machine, window->schedule->assignedRuntime[local], result->lastInMachine[machine]);
+		result->startTime[o] = window->schedule->startTime[local];
+		result->endTime[o] = window->schedule->endTime[local];
+	}
+}
+
+
+/**
+ * @brief	Ordenar as operaes de uma janela pelo tempo inicial
+ * @param	window	Janela
+ * @param	sorted	Array a preencher (tamanho igual  quantidade de operaes da janela)
+*/
+static void sortWindow(HorizonWindow* window, TimedOperation* sorted)
+{
+	for (int i = 0; i < window->instance->numberOfOperations; i++)
+	{
+		sorted[i].time = window->schedule->startTime[i];
+		sorted[i].operation = i;
+	}
+
+	qsort(sorted, window->instance->numberOfOperations, sizeof(TimedOperation), compareTimedOperations);
+}
+
+#pragma endregion
+
+
+#pragma region polimento de janelas
+
+/**
+ * @brief	Preparar o polimento das operaes fixadas de uma janela
+ *
+ *  criada uma instncia apenas com essas operaes, com o plano que foi fixado e os mesmos tempos mnimos de incio.
+ * So guardados o fim da ltima operao de cada mquina e de cada trabalho, porque a janela seguinte foi escalonada
+ * a partir desses tempos e o plano polido s pode ser usado se nenhum deles piorar.
+ * @param	window		Janela
+ * @param	sorted		Operaes da janela ordenadas pelo tempo inicial
+ * @param	committed	Quantidade de operaes fixadas (as primeiras de sorted)
+ * @param	iterations	Iteraes do polimento
+ * @param	seed		Semente do gerador de nmeros pseudo-aleatrios
+ * @param	polish		Dados do polimento a preencher
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool newPolish(HorizonWindow* window, TimedOperation* sorted, int committed, int iterations, unsigned long long seed, HorizonPolish* polish)
+{
+	int* operations = (int*)malloc(committed * sizeof(int));
+	int* local = (int*)malloc(window->instance->numberOfOperations * sizeof(int));
+
+	polish->window.instance = NULL;
+	polish->window.schedule = NULL;
+	polish->window.globalIndex = NULL;
+	polish->machineFrontier = NULL;
+	polish->jobFrontier = NULL;
+
+	if (operations == NULL || local == NULL)
+	{
+		free(operations);
+		free(local);
+		return false;
+	}
+
+	for (int i = 0; i < committed; i++)
+	{
+		operations[i] = sorted[i].operation;
+	}
+	qsort(operations, committed, sizeof(int), compareOperations);
+
+	HorizonWindow* target = &polish->window;
+	target->instance = newInstance_Subset(window->instance, operations, committed);
+	target->schedule = newSchedule(target->instance);
+	target->globalIndex = (int*)malloc(committed * sizeof(int));
+	polish->machineFrontier = (int*)malloc(window->instance->numberOfMachines * sizeof(int));
+	polish->jobFrontier = (int*)malloc(committed * sizeof(int));
+
+	if (target->instance == NULL || target->schedule == NULL || target->globalIndex == NULL || polish->machineFrontier == NULL || polish->jobFrontier == NULL)
+	{
+		free(operations);
+		free(local);
+		cleanWindow(target);
+		free(polish->machineFrontier);
+		free(polish->jobFrontier);
+		return false;
+	}
+
+	for (int i = 0; i < committed; i++)
+	{
+		target->globalIndex[i] = window->globalIndex[operations[i]];
+		target->schedule->releaseTime[i] = window->schedule->releaseTime[operations[i]];
+		local[operations[i]] = i;
+	}
+
+	for (int m = 0; m < window->instance->numberOfMachines; m++)
+	{
+		target->schedule->machineReleaseTime[m] = window->schedule->machineReleaseTime[m];
+	}
+
+	// reproduzir o plano fixado (as sequncias nas mquinas seguem o tempo inicial)
+	for (int i = 0; i < committed; i++)
+	{
+		int o = sorted[i].operation;
+		int machine = window->schedule->assignedMachine[o];
+
+		insertOperation_AtSchedule(target->schedule, local[o], machine, window->schedule->assignedRuntime[o], target->schedule->lastInMachine[machine]);
+	}
+
+	free(operations);
+	free(local);
+
+	evaluateSchedule(target->instance, target->schedule);
+
+	for (int m = 0; m < target->instance->numberOfMachines; m++)
+	{
+		int last = target->schedule->lastInMachine[m];
+		polish->machineFrontier[m] = last == -1 ? target->schedule->machineReleaseTime[m] : target->schedule->endTime[last];
+	}
+
+	for (int j = 0; j < target->instance->numberOfJobs; j++)
+	{
+		polish->jobFrontier[j] = target->schedule->endTime[target->instance->jobStart[j + 1] - 1];
+	}
+
+	polish->iterations = iterations;
+	polish->random = newRandom(seed);
+	polish->improved = false;
+
+	return true;
+}
+
+
+/**
+ * @brief	Polir as operaes fixadas de uma janela por iterated greedy (executada numa thread prpria)
+ * @param	argument	Dados do polimento
+*/
+static void runPolish(void* argument)
+{
+	HorizonPolish* polish = (HorizonPolish*)argument;
+	Instance* instance = polish->window.instance;
+	Schedule* schedule = polish->window.schedule;
+	int makespan = schedule->makespan;
+
+	improveSchedule_IteratedGreedy(instance, schedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, 0, polish->iterations,
+		nextRandom(&polish->random), NULL, NULL);
+
+	if (schedule->makespan >= makespan)
+	{
+		return;
+	}
+
+	// a janela seguinte usou os tempos anteriores, que no podem piorar
+	for (int m = 0; m < instance->numberOfMachines; m++)
+	{
+		int last = schedule->lastInMachine[m];
+
+		if ((last == -1 ? schedule->machineReleaseTime[m] : schedule->endTime[last]) > polish->machineFrontier[m])
+		{
+			return;
+		}
+	}
+
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		if (schedule->endTime[instance->jobStart[j + 1] - 1] > polish->jobFrontier[j])
+		{
+			return;
+		}
+	}
+
+	polish->improved = true;
+}
+
+
+/**
+ * @brief	Substituir no plano completo as operaes de uma janela polida
+ *
+ * As operaes da janela so as ltimas de cada mquina no plano completo, porque a janela seguinte ainda no foi fixada.
+ * @param	result		Plano completo
+ * @param	polish		Dados do polimento
+ * @param	sorted		Memria auxiliar (tamanho igual  quantidade de operaes da janela)
+*/
+static void applyPolish(Schedule* result, HorizonPolish* polish, TimedOperation* sorted)
+{
+	if (!polish->improved)
+	{
+		return;
+	}
+
+	HorizonWindow* window = &polish->window;
+
+	for (int i = 0; i < window->instance->numberOfOperations; i++)
+	{
+		removeOperation_AtSchedule(result, window->globalIndex[i]);
+	}
+
+	sortWindow(window, sorted);
+	commitWindow(result, window, sorted, window->instance->numberOfOperations);
+}
+
+
+/**
+ * @brief	Limpar os dados de um polimento da memria
+ * @param	polish	Dados do polimento
+*/
+static void cleanPolish(HorizonPolish* polish)
+{
+	cleanWindow(&polish->window);
+	free(polish->machineFrontier);
+	free(polish->jobFrontier);
+	polish->machineFrontier = NULL;
+	polish->jobFrontier = NULL;
+}
+
+#pragma endregion
+
+
+#pragma region horizonte deslizante
+
+/**
+ * @brief	Resolver o escalonamento de instncias muito grandes por horizonte deslizante
+ *
+ * As operaes so ordenadas pelo tempo inicial de um plano construdo pela regra gulosa e divididas em janelas de windowSize operaes.
+ * Cada janela  resolvida com o algoritmo indicado, com as operaes das janelas anteriores fixadas (como tempos mnimos de incio
+ * das mquinas e dos trabalhos). Das operaes de cada janela, s as que comeam mais cedo so fixadas, e as ltimas overlap
+ * voltam a ser escalonadas na janela seguinte. As janelas funcionam em pipeline: enquanto a janela k + 1  resolvida,
+ * as operaes fixadas da janela k so polidas noutra thread, e o resultado s  usado se no atrasar a janela seguinte.
+ * Alm do plano completo, a memria usada s depende do tamanho das janelas (no mximo duas janelas em simultneo).
+ * @param	instance				Instncia do problema
+ * @param	result					Plano onde  guardado o plano completo
+ * @param	windowSize				Quantidade de operaes de cada janela
+ * @param	overlap					Quantidade de operaes de cada janela que voltam a ser escalonadas na janela seguinte
+ * @param	engine					Algoritmo usado em cada janela
+ * @param	iterationsPerWindow		Iteraes do algoritmo em cada janela (e do polimento)
+ * @param	seed					Semente do gerador de nmeros pseudo-aleatrios
+ * @param	callback				Funo chamada com o plano completo no fim (ou NULL)
+ * @param	context					Dados passados  funo callback
+ * @return	Tempo total do plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_RollingHorizon(Instance* instance, Schedule* result, int windowSize, int overlap, SolverEngine engine, int iterationsPerWindow,
+	unsigned long long seed, IncumbentCallback callback, void* context)
+{
+	if (instance == NULL || result == NULL || windowSize <= 0)
+	{
+		return -1;
+	}
+
+	if (overlap < 0 || overlap > windowSize / 2) // cada janela tem de fixar pelo menos metade das suas operaes
+	{
+		overlap = windowSize / 2;
+	}
+
+	int n = instance->numberOfOperations;
+
+	// ordem das operaes pelo tempo inicial estimado pela regra gulosa
+	TimedOperation* sequence = (TimedOperation*)malloc(n * sizeof(TimedOperation));
+	TimedOperation* sorted = (TimedOperation*)malloc((windowSize + 1) * sizeof(TimedOperation));
+	int* operations = (int*)malloc((windowSize + 1) * sizeof(int));
+
+	if (sequence == NULL || sorted == NULL || operations == NULL || buildSchedule_Greedy(instance, result) < 0)
+	{
+		free(sequence);
+		free(sorted);
+		free(operations);
+		return -1;
+	}
+
+	for (int o = 0; o < n; o++)
+	{
+		sequence[o].time = result->startTime[o];
+		sequence[o].operation = o;
+	}
+	qsort(sequence, n, sizeof(TimedOperation), compareTimedOperations);
+
+	clearSchedule(result);
+
+	Random random = newRandom(seed);
+	HorizonWindow window = { NULL, NULL, NULL };
+	HorizonPolish polish = { { NULL, NULL, NULL }, NULL, NULL, 0, { 0, 0 }, false };
+	bool polishing = false, possible = true;
+	int next = 0, leftovers = 0;
+
+	while (possible && (next < n || leftovers > 0))
+	{
+		// as operaes que sobraram da janela anterior e as seguintes da ordem estimada
+		int count = leftovers;
+		while (count < windowSize && next < n)
+		{
+			operations[count++] = sequence[next++].operation;
+		}
+
+		if (!newWindow(instance, result, operations, count, &window))
+		{
+			possible = false;
+			break;
+		}
+
+		// polir a janela anterior enquanto esta  resolvida
+		Thread thread;
+		bool started = polishing && startThread(&thread, runPolish, &polish);
+
+		Schedule* candidate = engine == ENGINE_RANDOMIZED_GREEDY ? newSchedule(window.instance) : NULL;
+		possible = buildSchedule_Greedy(window.instance, window.schedule) >= 0
+			&& improveSchedule_Engine(window.instance, window.schedule, candidate, engine, iterationsPerWindow, 0, NULL, NULL, &random) >= 0;
+		cleanSchedule(&candidate);
+
+		if (polishing)
+		{
+			if (started)
+			{
+				joinThread(thread);
+			}
+			else
+			{
+				runPolish(&polish);
+			}
+
+			applyPolish(result, &polish, sorted);
+			cleanPolish(&polish);
+			polishing = false;
+		}
+
+		if (!possible)
+		{
+			break;
+		}
+
+		// fixar as operaes que comeam mais cedo, exceto na ltima janela, onde so fixadas todas
+		sortWindow(&window, sorted);
+		int committed = next < n ? count - overlap : count;
+
+		commitWindow(result, &window, sorted, committed);
+
+		leftovers = 0;
+		for (int i = committed; i < count; i++)
+		{
+			operations[leftovers++] = window.globalIndex[sorted[i].operation];
+		}
+
+		polishing = newPolish(&window, sorted, committed, iterationsPerWindow, nextRandom(&random), &polish);
+		cleanWindow(&window);
+	}
+
+	if (polishing)
+	{
+		runPolish(&polish);
+		applyPolish(result, &polish, sorted);
+		cleanPolish(&polish);
+	}
+
+	cleanWindow(&window);
+	free(sequence);
+	free(sorted);
+	free(operations);
+
+	if (!possible || evaluateSchedule(instance, result) < 0)
+	{
+		return -1;
+	}
+
+	if (callback != NULL)
+	{
+		callback(instance, result, context);
+	}
+
+	return result->makespan;
+}
+
+#pragma endregion
\ No newline at end of file
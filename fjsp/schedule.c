@@ -0,0 +1,2163 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas  instncia compacta do problema e aos planos por intervalos de tempo.
+ * @file	schedule.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+
+#pragma region instncias
+
+/**
+ * @brief	Chave para ordenar as operaes por trabalho e posio dentro do trabalho
+*/
+typedef struct OperationKey
+{
+	int job;
+	int position;
+	int operationID;
+} OperationKey;
+
+
+/**
+ * @brief	Comparar duas chaves de operaes (funo usada pelo qsort)
+ * @param	a	Apontador para a primeira chave
+ * @param	b	Apontador para a segunda chave
+ * @return	Valor negativo, zero ou positivo consoante a ordem das chaves
+*/
+static int compareOperationKeys(const void* a, const void* b)
+{
+	const OperationKey* x = (const OperationKey*)a;
+	const OperationKey* y = (const OperationKey*)b;
+
+	if (x->job != y->job)
+	{
+		return x->job - y->job;
+	}
+
+	if (x->position != y->position)
+	{
+		return x->position - y->position;
+	}
+
+	return x->operationID - y->operationID;
+}
+
+
+/**
+ * @brief	Comparar dois inteiros (funo usada pelo qsort)
+ * @param	a	Apontador para o primeiro inteiro
+ * @param	b	Apontador para o segundo inteiro
+ * @return	Valor negativo, zero ou positivo consoante a ordem dos inteiros
+*/
+static int compareIntegers(const void* a, const void* b)
+{
+	return *(const int*)a - *(const int*)b;
+}
+
+
+/**
+ * @brief	Aumentar a capacidade de um array de inteiros
+ * @param	array		Apontador para o array
+ * @param	capacity	Nova capacidade
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool growArray(int** array, int capacity)
+{
+	int* grown = (int*)realloc(*array, capacity * sizeof(int));
+	if (grown == NULL) // se no houver memria para alocar
+	{
+		return false;
+	}
+
+	*array = grown;
+
+	return true;
+}
+
+
+/**
+ * @brief	Criar uma instncia compacta do problema a partir das listas e da tabela hash das execues
+ * @param	jobs			Lista de trabalhos
+ * @param	machines		Lista de mquinas
+ * @param	operations		Lista de operaes
+ * @param	table			Tabela hash das execues de operaes
+ * @return	Nova instncia (ou NULL se os dados no permitem escalonar)
+*/
+Instance* newInstance(Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[])
+{
+	if (jobs == NULL || machines == NULL || operations == NULL || table == NULL || *table == NULL)
+	{
+		return NULL;
+	}
+
+	int numberOfJobs = countJobs(jobs), numberOfMachines = countMachines(machines), numberOfOperations = countOperations(operations), numberOfExecutions = 0;
+
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		for (Execution* execution = table[i] != NULL ? table[i]->start : NULL; execution != NULL; execution = execution->next)
+		{
+			numberOfExecutions++;
+		}
+	}
+
+	int* jobIDs = (int*)malloc((numberOfJobs + 1) * sizeof(int));
+	int* machineIDs = (int*)malloc((numberOfMachines + 1) * sizeof(int));
+	int* operationValues = (int*)malloc((3 * numberOfOperations + 1) * sizeof(int));
+	int* executionValues = (int*)malloc((3 * numberOfExecutions + 1) * sizeof(int));
+
+	if (jobIDs == NULL || machineIDs == NULL || operationValues == NULL || executionValues == NULL)
+	{
+		free(jobIDs);
+		free(machineIDs);
+		free(operationValues);
+		free(executionValues);
+		return NULL;
+	}
+
+	int counter = 0;
+	for (Job* job = jobs; job != NULL; job = job->next)
+	{
+		jobIDs[counter++] = job->id;
+	}
+
+	counter = 0;
+	for (Machine* machine = machines; machine != NULL; machine = machine->next)
+	{
+		machineIDs[counter++] = machine->id;
+	}
+
+	counter = 0;
+	for (Operation* operation = operations; operation != NULL; operation = operation->next, counter++)
+	{
+		operationValues[3 * counter] = operation->operationID;
+		operationValues[3 * counter + 1] = operation->jobID;
+		operationValues[3 * counter + 2] = operation->position;
+	}
+
+	// as execues ficam pela ordem da tabela hash
+	counter = 0;
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		for (Execution* execution = table[i] != NULL ? table[i]->start : NULL; execution != NULL; execution = execution->next, counter++)
+		{
+			executionValues[3 * counter] = execution->operationID;
+			executionValues[3 * counter + 1] = execution->machineID;
+			executionValues[3 * counter + 2] = execution->runtime;
+		}
+	}
+
+	Instance* new = newInstance_Arrays(jobIDs, numberOfJobs, machineIDs, numberOfMachines, operationValues, numberOfOperations, executionValues, numberOfExecutions);
+
+	free(jobIDs);
+	free(machineIDs);
+	free(operationValues);
+	free(executionValues);
+
+	return new;
+}
+
+
+/**
+ * @brief	Criar uma instncia compacta do problema a partir de arrays com os identificadores e os registos dos ficheiros
+ *
+ * Os identificadores repetidos de trabalhos e mquinas so ignorados. Se uma execuo (mesma operao e mesma mquina)
+ * estiver repetida, prevalece a ltima no array. As mquinas elegveis de cada operao ficam pela ordem das execues no array.
+ * @param	jobIDs				Identificadores dos trabalhos
+ * @param	numberOfJobs		Quantidade de trabalhos
+ * @param	machineIDs			Identificadores das mquinas
+ * @param	numberOfMachines	Quantidade de mquinas
+ * @param	operations			Operaes, com 3 valores cada (identificador, identificador do trabalho e posio no trabalho)
+ * @param	numberOfOperations	Quantidade de operaes
+ * @param	executions			Execues, com 3 valores cada (identificador da operao, identificador da mquina e tempo de execuo)
+ * @param	numberOfExecutions	Quantidade de execues
+ * @return	Nova instncia (ou NULL se os dados no permitem escalonar)
+*/
+Instance* newInstance_Arrays(int* jobIDs, int numberOfJobs, int* machineIDs, int numberOfMachines, int* operations, int numberOfOperations, int* executions, int numberOfExecutions)
+{
+	if (jobIDs == NULL || machineIDs == NULL || operations == NULL || executions == NULL || numberOfJobs <= 0 || numberOfMachines <= 0)
+	{
+		return NULL;
+	}
+
+	Instance* new = (Instance*)calloc(1, sizeof(Instance));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	new->jobIDs = (int*)malloc(numberOfJobs * sizeof(int));
+	new->machineIDs = (int*)malloc(numberOfMachines * sizeof(int));
+	new->jobStart = (int*)calloc(numberOfJobs + 1, sizeof(int));
+
+	if (new->jobIDs == NULL || new->machineIDs == NULL || new->jobStart == NULL)
+	{
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	// os trabalhos e as mquinas ficam ordenados pelo identificador, sem repetidos
+	memcpy(new->jobIDs, jobIDs, numberOfJobs * sizeof(int));
+	qsort(new->jobIDs, numberOfJobs, sizeof(int), compareIntegers);
+
+	for (int i = 0; i < numberOfJobs; i++)
+	{
+		if (new->numberOfJobs == 0 || new->jobIDs[i] != new->jobIDs[new->numberOfJobs - 1])
+		{
+			new->jobIDs[new->numberOfJobs++] = new->jobIDs[i];
+		}
+	}
+
+	memcpy(new->machineIDs, machineIDs, numberOfMachines * sizeof(int));
+	qsort(new->machineIDs, numberOfMachines, sizeof(int), compareIntegers);
+
+	for (int i = 0; i < numberOfMachines; i++)
+	{
+		if (new->numberOfMachines == 0 || new->machineIDs[i] != new->machineIDs[new->numberOfMachines - 1])
+		{
+			new->machineIDs[new->numberOfMachines++] = new->machineIDs[i];
+		}
+	}
+
+	int maxJobID = new->jobIDs[new->numberOfJobs - 1] > 0 ? new->jobIDs[new->numberOfJobs - 1] : 0;
+	int maxMachineID = new->machineIDs[new->numberOfMachines - 1] > 0 ? new->machineIDs[new->numberOfMachines - 1] : 0;
+	int maxOperationID = 0, counter = 0;
+
+	for (int i = 0; i < numberOfOperations; i++)
+	{
+		maxOperationID = operations[3 * i] > maxOperationID ? operations[3 * i] : maxOperationID;
+	}
+
+	// tabelas para converter identificadores em ndices
+	int* jobIndex = (int*)malloc((maxJobID + 1) * sizeof(int));
+	int* machineIndex = (int*)malloc((maxMachineID + 1) * sizeof(int));
+	int* operationIndex = (int*)malloc((maxOperationID + 1) * sizeof(int));
+	OperationKey* keys = (OperationKey*)malloc(numberOfOperations * sizeof(OperationKey) + 1);
+
+	if (jobIndex == NULL || machineIndex == NULL || operationIndex == NULL || keys == NULL)
+	{
+		free(jobIndex);
+		free(machineIndex);
+		free(operationIndex);
+		free(keys);
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	memset(jobIndex, -1, (maxJobID + 1) * sizeof(int));
+	memset(machineIndex, -1, (maxMachineID + 1) * sizeof(int));
+	memset(operationIndex, -1, (maxOperationID + 1) * sizeof(int));
+
+	for (int i = 0; i < new->numberOfJobs; i++)
+	{
+		if (new->jobIDs[i] >= 0)
+		{
+			jobIndex[new->jobIDs[i]] = i;
+		}
+	}
+
+	for (int i = 0; i < new->numberOfMachines; i++)
+	{
+		if (new->machineIDs[i] >= 0)
+		{
+			machineIndex[new->machineIDs[i]] = i;
+		}
+	}
+
+	// apenas so consideradas as operaes de trabalhos existentes
+	for (int i = 0; i < numberOfOperations; i++)
+	{
+		int operationID = operations[3 * i], jobID = operations[3 * i + 1];
+
+		if (jobID >= 0 && jobID <= maxJobID && jobIndex[jobID] != -1 && operationID >= 0)
+		{
+			keys[counter].job = jobIndex[jobID];
+			keys[counter].position = operations[3 * i + 2];
+			keys[counter].operationID = operationID;
+			counter++;
+		}
+	}
+	qsort(keys, counter, sizeof(OperationKey), compareOperationKeys);
+
+	new->numberOfOperations = counter;
+	new->operationIDs = (int*)malloc((counter + 1) * sizeof(int));
+	new->operationJob = (int*)malloc((counter + 1) * sizeof(int));
+	new->eligibleStart = (int*)calloc(counter + 1, sizeof(int));
+
+	if (new->operationIDs == NULL || new->operationJob == NULL || new->eligibleStart == NULL)
+	{
+		free(jobIndex);
+		free(machineIndex);
+		free(operationIndex);
+		free(keys);
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	for (int i = 0; i < counter; i++)
+	{
+		new->operationIDs[i] = keys[i].operationID;
+		new->operationJob[i] = keys[i].job;
+		operationIndex[keys[i].operationID] = i;
+		new->jobStart[keys[i].job + 1]++;
+	}
+
+	for (int j = 0; j < new->numberOfJobs; j++) // soma acumulada para obter o incio de cada trabalho
+	{
+		new->jobStart[j + 1] += new->jobStart[j];
+	}
+
+	// 1 passagem pelas execues: contar as mquinas elegveis de cada operao
+	for (int i = 0; i < numberOfExecutions; i++)
+	{
+		int operationID = executions[3 * i], machineID = executions[3 * i + 1];
+
+		if (operationID >= 0 && operationID <= maxOperationID && operationIndex[operationID] != -1
+			&& machineID >= 0 && machineID <= maxMachineID && machineIndex[machineID] != -1)
+		{
+			new->eligibleStart[operationIndex[operationID] + 1]++;
+		}
+	}
+
+	for (int o = 0; o < new->numberOfOperations; o++)
+	{
+		new->eligibleStart[o + 1] += new->eligibleStart[o];
+	}
+
+	int eligible = new->eligibleStart[new->numberOfOperations];
+	new->eligibleMachines = (int*)malloc((eligible + 1) * sizeof(int));
+	new->eligibleRuntimes = (int*)malloc((eligible + 1) * sizeof(int));
+	int* filled = (int*)calloc(new->numberOfOperations + 1, sizeof(int));
+	int* seen = (int*)malloc(new->numberOfMachines * sizeof(int));
+
+	if (new->eligibleMachines == NULL || new->eligibleRuntimes == NULL || filled == NULL || seen == NULL)
+	{
+		free(jobIndex);
+		free(machineIndex);
+		free(operationIndex);
+		free(keys);
+		free(filled);
+		free(seen);
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	// 2 passagem pelas execues: preencher as mquinas elegveis e os respetivos tempos
+	for (int i = 0; i < numberOfExecutions; i++)
+	{
+		int operationID = executions[3 * i], machineID = executions[3 * i + 1];
+
+		if (operationID >= 0 && operationID <= maxOperationID && operationIndex[operationID] != -1
+			&& machineID >= 0 && machineID <= maxMachineID && machineIndex[machineID] != -1)
+		{
+			int o = operationIndex[operationID];
+			int k = new->eligibleStart[o] + filled[o]++;
+
+			new->eligibleMachines[k] = machineIndex[machineID];
+			new->eligibleRuntimes[k] = executions[3 * i + 2];
+		}
+	}
+
+	// remover as execues repetidas (de trs para a frente, para prevalecer a ltima), compactando os arrays
+	memset(seen, -1, new->numberOfMachines * sizeof(int));
+
+	for (int o = 0, k = 0, first = 0; o < new->numberOfOperations; o++)
+	{
+		int last = new->eligibleStart[o + 1];
+
+		for (int e = last - 1; e >= first; e--)
+		{
+			if (seen[new->eligibleMachines[e]] == o)
+			{
+				new->eligibleMachines[e] = -1;
+			}
+			else
+			{
+				seen[new->eligibleMachines[e]] = o;
+			}
+		}
+
+		for (int e = first; e < last; e++)
+		{
+			if (new->eligibleMachines[e] != -1)
+			{
+				new->eligibleMachines[k] = new->eligibleMachines[e];
+				new->eligibleRuntimes[k++] = new->eligibleRuntimes[e];
+			}
+		}
+
+		new->eligibleStart[o + 1] = k;
+		first = last;
+	}
+
+	new->numberOfExecutions = new->eligibleStart[new->numberOfOperations];
+
+	free(jobIndex);
+	free(machineIndex);
+	free(operationIndex);
+	free(keys);
+	free(filled);
+	free(seen);
+
+	// no  possvel escalonar se alguma operao no tiver mquinas onde ser executada
+	for (int o = 0; o < new->numberOfOperations; o++)
+	{
+		if (new->eligibleStart[o] == new->eligibleStart[o + 1])
+		{
+			cleanInstance(&new);
+			return NULL;
+		}
+	}
+
+	if (new->numberOfOperations == 0)
+	{
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	new->jobsCapacity = new->numberOfJobs;
+	new->operationsCapacity = new->numberOfOperations;
+	new->executionsCapacity = new->numberOfExecutions;
+
+	return new;
+}
+
+
+/**
+ * @brief	Criar uma instncia apenas com algumas operaes de outra instncia (por exemplo, uma janela de tempo)
+ *
+ * As mquinas so as mesmas. Os trabalhos sem operaes selecionadas no fazem parte da nova instncia.
+ * @param	instance		Instncia do problema
+ * @param	operations		ndices das operaes, por ordem crescente
+ * @param	count			Quantidade de operaes
+ * @return	Nova instncia, em que a operao i corresponde a operations[i] (ou NULL se no foi possvel)
+*/
+Instance* newInstance_Subset(Instance* instance, int* operations, int count)
+{
+	if (instance == NULL || operations == NULL || count <= 0)
+	{
+		return NULL;
+	}
+
+	Instance* new = (Instance*)calloc(1, sizeof(Instance));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	int numberOfJobs = 0, numberOfExecutions = 0;
+	for (int i = 0; i < count; i++)
+	{
+		int o = operations[i];
+
+		if (i == 0 || instance->operationJob[o] != instance->operationJob[operations[i - 1]])
+		{
+			numberOfJobs++;
+		}
+
+		numberOfExecutions += instance->eligibleStart[o + 1] - instance->eligibleStart[o];
+	}
+
+	new->numberOfJobs = numberOfJobs;
+	new->numberOfMachines = instance->numberOfMachines;
+	new->numberOfOperations = count;
+	new->numberOfExecutions = numberOfExecutions;
+	new->jobIDs = (int*)malloc(numberOfJobs * sizeof(int));
+	new->machineIDs = (int*)malloc(instance->numberOfMachines * sizeof(int));
+	new->operationIDs = (int*)malloc(count * sizeof(int));
+	new->operationJob = (int*)malloc(count * sizeof(int));
+	new->jobStart = (int*)malloc((numberOfJobs + 1) * sizeof(int));
+	new->eligibleStart = (int*)malloc((count + 1) * sizeof(int));
+	new->eligibleMachines = (int*)malloc(numberOfExecutions * sizeof(int));
+	new->eligibleRuntimes = (int*)malloc(numberOfExecutions * sizeof(int));
+
+	if (new->jobIDs == NULL || new->machineIDs == NULL || new->operationIDs == NULL || new->operationJob == NULL
+		|| new->jobStart == NULL || new->eligibleStart == NULL || new->eligibleMachines == NULL || new->eligibleRuntimes == NULL)
+	{
+		cleanInstance(&new);
+		return NULL;
+	}
+
+	memcpy(new->machineIDs, instance->machineIDs, instance->numberOfMachines * sizeof(int));
+
+	int job = -1, k = 0;
+	for (int i = 0; i < count; i++)
+	{
+		int o = operations[i];
+
+		if (i == 0 || instance->operationJob[o] != instance->operationJob[operations[i - 1]])
+		{
+			job++;
+			new->jobIDs[job] = instance->jobIDs[instance->operationJob[o]];
+			new->jobStart[job] = i;
+		}
+
+		new->operationIDs[i] = instance->operationIDs[o];
+		new->operationJob[i] = job;
+		new->eligibleStart[i] = k;
+
+		for (int e = instance->eligibleStart[o]; e < instance->eligibleStart[o + 1]; e++)
+		{
+			new->eligibleMachines[k] = instance->eligibleMachines[e];
+			new->eligibleRuntimes[k] = instance->eligibleRuntimes[e];
+			k++;
+		}
+	}
+
+	new->jobStart[numberOfJobs] = count;
+	new->eligibleStart[count] = k;
+	new->jobsCapacity = numberOfJobs;
+	new->operationsCapacity = count;
+	new->executionsCapacity = numberOfExecutions;
+
+	return new;
+}
+
+
+/**
+ * @brief	Obter o tempo de execuo de uma operao numa mquina
+ * @param	instance	Instncia do problema
+ * @param	operation	ndice da operao
+ * @param	machine		ndice da mquina
+ * @return	Tempo de execuo (ou -1 se a mquina no for elegvel)
+*/
+int getRuntime_AtInstance(Instance* instance, int operation, int machine)
+{
+	for (int k = instance->eligibleStart[operation]; k < instance->eligibleStart[operation + 1]; k++)
+	{
+		if (instance->eligibleMachines[k] == machine)
+		{
+			return instance->eligibleRuntimes[k];
+		}
+	}
+
+	return -1;
+}
+
+
+/**
+ * @brief	Calcular o trabalho mnimo que falta a cada trabalho depois de cada operao (soma dos menores tempos de execuo das operaes
+ *			seguintes), um limite inferior usado para abandonar construes que j no podem ser melhores
+ * @param	instance	Instncia do problema
+ * @param	tails		Array onde  guardado o trabalho mnimo depois de cada operao
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool getJobTails_OfInstance(Instance* instance, int* tails)
+{
+	if (instance == NULL || tails == NULL)
+	{
+		return false;
+	}
+
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		int remaining = 0;
+
+		for (int o = instance->jobStart[j + 1] - 1; o >= instance->jobStart[j]; o--)
+		{
+			tails[o] = remaining;
+
+			int fastest = -1;
+			for (int k = instance->eligibleStart[o]; k < instance->eligibleStart[o + 1]; k++)
+			{
+				fastest = fastest == -1 || instance->eligibleRuntimes[k] < fastest ? instance->eligibleRuntimes[k] : fastest;
+			}
+
+			remaining += fastest > 0 ? fastest : 0;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Obter o ndice de uma operao na instncia a partir do seu identificador
+ * @param	instance		Instncia do problema
+ * @param	operationID		Identificador da operao
+ * @return	ndice da operao (ou -1 se no existir)
+*/
+int getOperationIndex_AtInstance(Instance* instance, int operationID)
+{
+	if (instance == NULL)
+	{
+		return -1;
+	}
+
+	for (int o = 0; o < instance->numberOfOperations; o++)
+	{
+		if (instance->operationIDs[o] == operationID)
+		{
+			return o;
+		}
+	}
+
+	return -1;
+}
+
+
+/**
+ * @brief	Obter o ndice de uma mquina na instncia a partir do seu identificador (pesquisa binria, porque esto ordenadas)
+ * @param	instance	Instncia do problema
+ * @param	machineID	Identificador da mquina
+ * @return	ndice da mquina (ou -1 se no existir)
+*/
+int getMachineIndex_AtInstance(Instance* instance, int machineID)
+{
+	if (instance == NULL)
+	{
+		return -1;
+	}
+
+	int* found = (int*)bsearch(&machineID, instance->machineIDs, instance->numberOfMachines, sizeof(int), compareIntegers);
+
+	return found == NULL ? -1 : (int)(found - instance->machineIDs);
+}
+
+
+/**
+ * @brief	Atualizar o tempo de execuo de uma operao numa mquina elegvel
+ * @param	instance	Instncia do problema
+ * @param	operation	ndice da operao
+ * @param	machine		ndice da mquina
+ * @param	runtime		Novo tempo de execuo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool setRuntime_AtInstance(Instance* instance, int operation, int machine, int runtime)
+{
+	if (instance == NULL || operation < 0 || operation >= instance->numberOfOperations)
+	{
+		return false;
+	}
+
+	for (int k = instance->eligibleStart[operation]; k < instance->eligibleStart[operation + 1]; k++)
+	{
+		if (instance->eligibleMachines[k] == machine)
+		{
+			instance->eligibleRuntimes[k] = runtime;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/**
+ * @brief	Remover uma mquina das mquinas elegveis de todas as operaes (por exemplo, quando avaria)
+ *
+ * O ndice da mquina continua vlido, mas deixa de ser elegvel para qualquer operao.
+ * @param	instance	Instncia do problema
+ * @param	machine		ndice da mquina
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool removeMachine_AtInstance(Instance* instance, int machine)
+{
+	if (instance == NULL || machine < 0 || machine >= instance->numberOfMachines)
+	{
+		return false;
+	}
+
+	int counter = 0;
+
+	for (int o = 0; o < instance->numberOfOperations; o++)
+	{
+		int first = instance->eligibleStart[o];
+		instance->eligibleStart[o] = counter;
+
+		for (int k = first; k < instance->eligibleStart[o + 1]; k++)
+		{
+			if (instance->eligibleMachines[k] != machine)
+			{
+				instance->eligibleMachines[counter] = instance->eligibleMachines[k];
+				instance->eligibleRuntimes[counter] = instance->eligibleRuntimes[k];
+				counter++;
+			}
+		}
+	}
+
+	instance->eligibleStart[instance->numberOfOperations] = counter;
+	instance->numberOfExecutions = counter;
+
+	return true;
+}
+
+
+/**
+ * @brief	Acrescentar um novo trabalho (com as suas operaes e mquinas elegveis) a uma instncia
+ *
+ * O trabalho  recusado se o seu identificador ou o de alguma operao j existir na instncia (ou se repetir dentro do trabalho),
+ * porque as reparaes procuram as operaes pelo identificador, ou se uma operao tiver a mesma mquina mais do que uma vez.
+ * Estas verificaes percorrem os identificadores da instncia uma vez por operao do trabalho.
+ * A capacidade dos arrays  duplicada quando no chega, pelo que acrescentar k operaes custa, em mdia, tempo proporcional a k.
+ * @param	instance	Instncia do problema
+ * @param	arrival		Dados do trabalho
+ * @return	ndice do novo trabalho (ou -1 se no foi possvel, ficando a instncia como estava)
+*/
+int appendJob_AtInstance(Instance* instance, JobArrival* arrival)
+{
+	if (instance == NULL || arrival == NULL || arrival->numberOfOperations <= 0)
+	{
+		return -1;
+	}
+
+	int numberOfExecutions = arrival->eligibleStart[arrival->numberOfOperations] - arrival->eligibleStart[0];
+
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		if (instance->jobIDs[j] == arrival->jobID) // o trabalho j existe
+		{
+			return -1;
+		}
+	}
+
+	// todas as operaes tm de ser novas e ter mquinas elegveis conhecidas, sem repeties, e tempos positivos
+	for (int i = 0; i < arrival->numberOfOperations; i++)
+	{
+		if (arrival->eligibleStart[i] >= arrival->eligibleStart[i + 1] || getOperationIndex_AtInstance(instance, arrival->operationIDs[i]) != -1)
+		{
+			return -1;
+		}
+
+		for (int p = 0; p < i; p++)
+		{
+			if (arrival->operationIDs[p] == arrival->operationIDs[i])
+			{
+				return -1;
+			}
+		}
+
+		for (int k = arrival->eligibleStart[i]; k < arrival->eligibleStart[i + 1]; k++)
+		{
+			if (getMachineIndex_AtInstance(instance, arrival->machineIDs[k]) == -1 || arrival->runtimes[k] <= 0)
+			{
+				return -1;
+			}
+
+			for (int p = arrival->eligibleStart[i]; p < k; p++)
+			{
+				if (arrival->machineIDs[p] == arrival->machineIDs[k])
+				{
+					return -1;
+				}
+			}
+		}
+	}
+
+	int jobs = instance->numberOfJobs + 1;
+	int operations = instance->numberOfOperations + arrival->numberOfOperations;
+	int executions = instance->numberOfExecutions + numberOfExecutions;
+
+	if (jobs > instance->jobsCapacity)
+	{
+		int capacity = jobs > instance->jobsCapacity * 2 ? jobs : instance->jobsCapacity * 2;
+
+		if (!growArray(&instance->jobIDs, capacity) || !growArray(&instance->jobStart, capacity + 1))
+		{
+			return -1;
+		}
+
+		instance->jobsCapacity = capacity;
+	}
+
+	if (operations > instance->operationsCapacity)
+	{
+		int capacity = operations > instance->operationsCapacity * 2 ? operations : instance->operationsCapacity * 2;
+
+		if (!growArray(&instance->operationIDs, capacity) || !growArray(&instance->operationJob, capacity)
+			|| !growArray(&instance->eligibleStart, capacity + 1))
+		{
+			return -1;
+		}
+
+		instance->operationsCapacity = capacity;
+	}
+
+	if (executions > instance->executionsCapacity)
+	{
+		int capacity = executions > instance->executionsCapacity * 2 ? executions : instance->executionsCapacity * 2;
+
+		if (!growArray(&instance->eligibleMachines, capacity) || !growArray(&instance->eligibleRuntimes, capacity))
+		{
+			return -1;
+		}
+
+		instance->executionsCapacity = capacity;
+	}
+
+	int job = instance->numberOfJobs;
+	int k = instance->numberOfExecutions;
+
+	instance->jobIDs[job] = arrival->jobID;
+
+	for (int i = 0; i < arrival->numberOfOperations; i++)
+	{
+		int o = instance->numberOfOperations + i;
+
+		instance->operationIDs[o] = arrival->operationIDs[i];
+		instance->operationJob[o] = job;
+		instance->eligibleStart[o] = k;
+
+		for (int e = arrival->eligibleStart[i]; e < arrival->eligibleStart[i + 1]; e++)
+		{
+			instance->eligibleMachines[k] = getMachineIndex_AtInstance(instance, arrival->machineIDs[e]);
+			instance->eligibleRuntimes[k] = arrival->runtimes[e];
+			k++;
+		}
+	}
+
+	instance->numberOfJobs = jobs;
+	instance->numberOfOperations = operations;
+	instance->numberOfExecutions = executions;
+	instance->jobStart[jobs] = operations;
+	instance->eligibleStart[operations] = executions;
+
+	return job;
+}
+
+
+/**
+ * @brief	Limpar uma instncia da memria
+ * @param	instance	Apontador para a instncia
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanInstance(Instance** instance)
+{
+	if (instance == NULL || *instance == NULL)
+	{
+		return false;
+	}
+
+	free((*instance)->jobIDs);
+	free((*instance)->machineIDs);
+	free((*instance)->operationIDs);
+	free((*instance)->operationJob);
+	free((*instance)->jobStart);
+	free((*instance)->eligibleStart);
+	free((*instance)->eligibleMachines);
+	free((*instance)->eligibleRuntimes);
+	free(*instance);
+
+	*instance = NULL;
+
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region planos por intervalos de tempo
+
+/**
+ * @brief	Obter a chave de Zobrist de uma deciso (operao na mquina, depois da operao anterior)
+ *
+ * As chaves so calculadas por mistura de bits (finalizador do splitmix64), em vez de guardadas numa tabela,
+ * e so iguais em todos os planos, para que as impresses digitais possam ser comparadas entre planos.
+ * @param	operation	ndice da operao
+ * @param	machine		ndice da mquina
+ * @param	previous	ndice da operao anterior na mquina (ou -1 se for a primeira)
+ * @return	Chave de 64 bits
+*/
+static unsigned long long getZobristKey(int operation, int machine, int previous)
+{
+	unsigned long long z = ((unsigned long long)(unsigned int)operation << 32) | (unsigned int)(previous + 1);
+	z += (unsigned long long)(machine + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+	return z ^ (z >> 31);
+}
+
+
+/**
+ * @brief	Criar um plano vazio (sem operaes escalonadas) para uma instncia
+ * @param	instance	Instncia do problema
+ * @return	Novo plano
+*/
+Schedule* newSchedule(Instance* instance)
+{
+	if (instance == NULL)
+	{
+		return NULL;
+	}
+
+	Schedule* new = (Schedule*)calloc(1, sizeof(Schedule));
+	if (new == NULL) // se no houver memria para alocar
+	{
+		return NULL;
+	}
+
+	int n = instance->numberOfOperations;
+	int m = instance->numberOfMachines;
+
+	new->numberOfOperations = n;
+	new->numberOfMachines = m;
+	new->capacity = n;
+	new->assignedMachine = (int*)malloc(n * sizeof(int));
+	new->assignedRuntime = (int*)malloc(n * sizeof(int));
+	new->startTime = (int*)malloc(n * sizeof(int));
+	new->endTime = (int*)malloc(n * sizeof(int));
+	new->releaseTime = (int*)calloc(n + 1, sizeof(int));
+	new->previousInMachine = (int*)malloc(n * sizeof(int));
+	new->nextInMachine = (int*)malloc(n * sizeof(int));
+	new->previousInJob = (int*)malloc(n * sizeof(int));
+	new->nextInJob = (int*)malloc(n * sizeof(int));
+	new->order = (int*)malloc(n * sizeof(int));
+	new->pending = (int*)malloc(n * sizeof(int));
+	new->firstInMachine = (int*)malloc((m + 1) * sizeof(int));
+	new->lastInMachine = (int*)malloc((m + 1) * sizeof(int));
+	new->machineReleaseTime = (int*)calloc(m + 1, sizeof(int));
+
+	if (new->assignedMachine == NULL || new->assignedRuntime == NULL || new->startTime == NULL || new->endTime == NULL || new->releaseTime == NULL
+		|| new->previousInMachine == NULL || new->nextInMachine == NULL || new->previousInJob == NULL || new->nextInJob == NULL
+		|| new->order == NULL || new->pending == NULL || new->firstInMachine == NULL || new->lastInMachine == NULL
+		|| new->machineReleaseTime == NULL)
+	{
+		cleanSchedule(&new);
+		return NULL;
+	}
+
+	clearSchedule(new);
+
+	return new;
+}
+
+
+/**
+ * @brief	Copiar um plano para outro plano da mesma instncia
+ * @param	destination		Plano de destino
+ * @param	source			Plano de origem
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool copySchedule(Schedule* destination, Schedule* source)
+{
+	if (destination == NULL || source == NULL || destination->numberOfOperations != source->numberOfOperations
+		|| destination->numberOfMachines != source->numberOfMachines)
+	{
+		return false;
+	}
+
+	size_t operationsSize = source->numberOfOperations * sizeof(int);
+	size_t machinesSize = source->numberOfMachines * sizeof(int);
+
+	memcpy(destination->assignedMachine, source->assignedMachine, operationsSize);
+	memcpy(destination->assignedRuntime, source->assignedRuntime, operationsSize);
+	memcpy(destination->startTime, source->startTime, operationsSize);
+	memcpy(destination->endTime, source->endTime, operationsSize);
+	memcpy(destination->releaseTime, source->releaseTime, operationsSize);
+	memcpy(destination->previousInMachine, source->previousInMachine, operationsSize);
+	memcpy(destination->nextInMachine, source->nextInMachine, operationsSize);
+	memcpy(destination->previousInJob, source->previousInJob, operationsSize);
+	memcpy(destination->nextInJob, source->nextInJob, operationsSize);
+	memcpy(destination->order, source->order, operationsSize);
+	memcpy(destination->firstInMachine, source->firstInMachine, machinesSize);
+	memcpy(destination->lastInMachine, source->lastInMachine, machinesSize);
+	memcpy(destination->machineReleaseTime, source->machineReleaseTime, machinesSize);
+
+	destination->numberOfScheduled = source->numberOfScheduled;
+	destination->makespan = source->makespan;
+	destination->fingerprint = source->fingerprint;
+
+	return true;
+}
+
+
+/**
+ * @brief	Remover todas as operaes de um plano (os tempos mnimos de incio das operaes e das mquinas mantm-se)
+ * @param	schedule	Plano
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool clearSchedule(Schedule* schedule)
+{
+	if (schedule == NULL)
+	{
+		return false;
+	}
+
+	for (int o = 0; o < schedule->numberOfOperations; o++)
+	{
+		schedule->assignedMachine[o] = -1;
+		schedule->assignedRuntime[o] = 0;
+		schedule->startTime[o] = 0;
+		schedule->endTime[o] = 0;
+		schedule->previousInMachine[o] = -1;
+		schedule->nextInMachine[o] = -1;
+		schedule->previousInJob[o] = -1;
+		schedule->nextInJob[o] = -1;
+	}
+
+	for (int m = 0; m < schedule->numberOfMachines; m++)
+	{
+		schedule->firstInMachine[m] = -1;
+		schedule->lastInMachine[m] = -1;
+	}
+
+	schedule->numberOfScheduled = 0;
+	schedule->makespan = 0;
+	schedule->fingerprint = 0;
+
+	return true;
+}
+
+
+/**
+ * @brief	Alterar a quantidade de operaes de um plano (por exemplo, depois de acrescentar trabalhos  instncia)
+ *
+ * As novas operaes ficam por escalonar. A capacidade dos arrays  duplicada quando no chega.
+ * @param	schedule				Plano
+ * @param	numberOfOperations		Nova quantidade de operaes (no pode ser menor do que a atual)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool resizeSchedule(Schedule* schedule, int numberOfOperations)
+{
+	if (schedule == NULL || numberOfOperations < schedule->numberOfOperations)
+	{
+		return false;
+	}
+
+	if (numberOfOperations > schedule->capacity)
+	{
+		int capacity = numberOfOperations > schedule->capacity * 2 ? numberOfOperations : schedule->capacity * 2;
+
+		if (!growArray(&schedule->assignedMachine, capacity) || !growArray(&schedule->assignedRuntime, capacity)
+			|| !growArray(&schedule->startTime, capacity) || !growArray(&schedule->endTime, capacity) || !growArray(&schedule->releaseTime, capacity)
+			|| !growArray(&schedule->previousInMachine, capacity) || !growArray(&schedule->nextInMachine, capacity)
+			|| !growArray(&schedule->previousInJob, capacity) || !growArray(&schedule->nextInJob, capacity)
+			|| !growArray(&schedule->order, capacity) || !growArray(&schedule->pending, capacity))
+		{
+			return false;
+		}
+
+		schedule->capacity = capacity;
+	}
+
+	for (int o = schedule->numberOfOperations; o < numberOfOperations; o++)
+	{
+		schedule->assignedMachine[o] = -1;
+		schedule->assignedRuntime[o] = 0;
+		schedule->startTime[o] = 0;
+		schedule->endTime[o] = 0;
+		schedule->releaseTime[o] = 0;
+		schedule->previousInMachine[o] = -1;
+		schedule->nextInMachine[o] = -1;
+		schedule->previousInJob[o] = -1;
+		schedule->nextInJob[o] = -1;
+		schedule->order[o] = o; // s  vlida depois de o plano ser avaliado
+		schedule->pending[o] = 0;
+	}
+
+	schedule->numberOfOperations = numberOfOperations;
+
+	return true;
+}
+
+
+/**
+ * @brief	Inserir uma operao na sequncia de uma mquina, a seguir a outra operao
+ * @param	schedule	Plano
+ * @param	operation	ndice da operao a inserir
+ * @param	machine		ndice da mquina
+ * @param	runtime		Tempo de execuo da operao na mquina
+ * @param	previous	ndice da operao aps a qual  inserida (ou -1 para inserir no incio da mquina)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool insertOperation_AtSchedule(Schedule* schedule, int operation, int machine, int runtime, int previous)
+{
+	if (schedule == NULL || schedule->assignedMachine[operation] != -1) // no permitir inserir uma operao j escalonada
+	{
+		return false;
+	}
+
+	if (previous != -1 && schedule->assignedMachine[previous] != machine)
+	{
+		return false;
+	}
+
+	int next = previous == -1 ? schedule->firstInMachine[machine] : schedule->nextInMachine[previous];
+
+	// a operao seguinte passa a ter a nova operao como anterior
+	schedule->fingerprint ^= getZobristKey(operation, machine, previous);
+	if (next != -1)
+	{
+		schedule->fingerprint ^= getZobristKey(next, machine, previous) ^ getZobristKey(next, machine, operation);
+	}
+
+	schedule->assignedMachine[operation] = machine;
+	schedule->assignedRuntime[operation] = runtime;
+	schedule->previousInMachine[operation] = previous;
+	schedule->nextInMachine[operation] = next;
+
+	if (previous == -1)
+	{
+		schedule->firstInMachine[machine] = operation;
+	}
+	else
+	{
+		schedule->nextInMachine[previous] = operation;
+	}
+
+	if (next == -1)
+	{
+		schedule->lastInMachine[machine] = operation;
+	}
+	else
+	{
+		schedule->previousInMachine[next] = operation;
+	}
+
+	schedule->numberOfScheduled++;
+
+	return true;
+}
+
+
+/**
+ * @brief	Remover uma operao da sequncia da sua mquina
+ * @param	schedule	Plano
+ * @param	operation	ndice da operao a remover
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool removeOperation_AtSchedule(Schedule* schedule, int operation)
+{
+	if (schedule == NULL || schedule->assignedMachine[operation] == -1) // se a operao no estiver escalonada
+	{
+		return false;
+	}
+
+	int machine = schedule->assignedMachine[operation];
+	int previous = schedule->previousInMachine[operation];
+	int next = schedule->nextInMachine[operation];
+
+	schedule->fingerprint ^= getZobristKey(operation, machine, previous);
+	if (next != -1)
+	{
+		schedule->fingerprint ^= getZobristKey(next, machine, operation) ^ getZobristKey(next, machine, previous);
+	}
+
+	if (previous == -1)
+	{
+		schedule->firstInMachine[machine] = next;
+	}
+	else
+	{
+		schedule->nextInMachine[previous] = next;
+	}
+
+	if (next == -1)
+	{
+		schedule->lastInMachine[machine] = previous;
+	}
+	else
+	{
+		schedule->previousInMachine[next] = previous;
+	}
+
+	schedule->assignedMachine[operation] = -1;
+	schedule->previousInMachine[operation] = -1;
+	schedule->nextInMachine[operation] = -1;
+	schedule->numberOfScheduled--;
+
+	return true;
+}
+
+
+/**
+ * @brief	Calcular os tempos iniciais e finais das operaes escalonadas (plano semi-ativo) e o tempo total do plano
+ *
+ * Os tempos so o caminho mais longo no grafo formado pela ordem das operaes em cada trabalho e pela sequncia em cada mquina,
+ * percorrido por ordem topolgica, sem comear nenhuma operao antes do seu tempo mnimo de incio nem antes de a mquina estar disponvel. As operaes no escalonadas so ignoradas.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano
+ * @return	Tempo total do plano (ou -1 se as sequncias formarem um ciclo)
+*/
+int evaluateSchedule(Instance* instance, Schedule* schedule)
+{
+	if (instance == NULL || schedule == NULL)
+	{
+		return -1;
+	}
+
+	int* pending = schedule->pending; // quantidade de predecessores por processar de cada operao
+	int* order = schedule->order;
+	int head = 0, tail = 0;
+
+	// ligar cada operao escalonada s operaes escalonadas anterior e seguinte do mesmo trabalho
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		int last = -1;
+
+		for (int o = instance->jobStart[j]; o < instance->jobStart[j + 1]; o++)
+		{
+			if (schedule->assignedMachine[o] == -1)
+			{
+				continue;
+			}
+
+			schedule->previousInJob[o] = last;
+			schedule->nextInJob[o] = -1;
+			pending[o] = (last != -1) + (schedule->previousInMachine[o] != -1);
+			schedule->startTime[o] = schedule->releaseTime[o];
+
+			if (schedule->previousInMachine[o] == -1 && schedule->machineReleaseTime[schedule->assignedMachine[o]] > schedule->startTime[o])
+			{
+				schedule->startTime[o] = schedule->machineReleaseTime[schedule->assignedMachine[o]];
+			}
+
+			if (last != -1)
+			{
+				schedule->nextInJob[last] = o;
+			}
+
+			last = o;
+
+			if (pending[o] == 0)
+			{
+				order[tail++] = o;
+			}
+		}
+	}
+
+	int makespan = 0;
+
+	while (head < tail)
+	{
+		int o = order[head++];
+		int end = schedule->startTime[o] + schedule->assignedRuntime[o];
+		int successors[2] = { schedule->nextInJob[o], schedule->nextInMachine[o] };
+
+		schedule->endTime[o] = end;
+		if (end > makespan)
+		{
+			makespan = end;
+		}
+
+		for (int i = 0; i < 2; i++)
+		{
+			int s = successors[i];
+
+			if (s == -1)
+			{
+				continue;
+			}
+
+			if (end > schedule->startTime[s])
+			{
+				schedule->startTime[s] = end;
+			}
+
+			if (--pending[s] == 0)
+			{
+				order[tail++] = s;
+			}
+		}
+	}
+
+	if (tail < schedule->numberOfScheduled) // se nem todas as operaes foram processadas, existe um ciclo
+	{
+		schedule->makespan = -1;
+		return -1;
+	}
+
+	schedule->makespan = makespan;
+
+	return makespan;
+}
+
+
+/**
+ * @brief	Calcular de raiz a impresso digital de um plano (normalmente  mantida por insertOperation_AtSchedule e removeOperation_AtSchedule)
+ *
+ *  o ou exclusivo das chaves de Zobrist de todas as decises (operao, mquina, anterior na mquina), pelo que planos com as
+ * mesmas sequncias nas mquinas tm a mesma impresso digital, independentemente da ordem em que foram construdos.
+ * @param	schedule	Plano
+ * @return	Impresso digital do plano
+*/
+unsigned long long getFingerprint_OfSchedule(Schedule* schedule)
+{
+	if (schedule == NULL)
+	{
+		return 0;
+	}
+
+	unsigned long long fingerprint = 0;
+
+	for (int o = 0; o < schedule->numberOfOperations; o++)
+	{
+		if (schedule->assignedMachine[o] != -1)
+		{
+			fingerprint ^= getZobristKey(o, schedule->assignedMachine[o], schedule->previousInMachine[o]);
+		}
+	}
+
+	return fingerprint;
+}
+
+
+/**
+ * @brief	Calcular a cauda de cada operao escalonada, ou seja, o caminho mais longo desde o seu incio at ao fim do plano
+ *
+ * Deve ser chamada depois de evaluateSchedule, porque usa a ordem topolgica calculada por essa funo.
+ * @param	schedule	Plano avaliado
+ * @param	tails		Array onde so guardadas as caudas (tamanho igual  quantidade de operaes)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool getTails_OfSchedule(Schedule* schedule, int* tails)
+{
+	if (schedule == NULL || tails == NULL || schedule->makespan < 0)
+	{
+		return false;
+	}
+
+	for (int i = schedule->numberOfScheduled - 1; i >= 0; i--)
+	{
+		int o = schedule->order[i];
+		int nextJob = schedule->nextInJob[o];
+		int nextMachine = schedule->nextInMachine[o];
+		int tail = 0;
+
+		if (nextJob != -1 && tails[nextJob] > tail)
+		{
+			tail = tails[nextJob];
+		}
+
+		if (nextMachine != -1 && tails[nextMachine] > tail)
+		{
+			tail = tails[nextMachine];
+		}
+
+		tails[o] = tail + schedule->assignedRuntime[o];
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Escolher a mquina elegvel em que uma operao termina mais cedo, calculando max(ready, machineReady[m]) + runtime para cada uma
+ *
+ * Se o processador suportar AVX2, as operaes com pelo menos 8 mquinas elegveis so avaliadas 8 mquinas de cada vez
+ * (selectMachine_AVX2). A escolha  sempre a mesma da verso escalar, incluindo nos empates.
+ * @param	instance		Instncia do problema
+ * @param	operation		ndice da operao
+ * @param	ready			Tempo a partir do qual a operao pode comear (fim da operao anterior do trabalho e tempo mnimo de incio)
+ * @param	machineReady	Tempo em que cada mquina fica disponvel
+ * @param	random			Gerador para escolher uniformemente entre empates (ou NULL para escolher o menor tempo de execuo)
+ * @param	end				Apontador onde  guardado o fim da operao na mquina escolhida
+ * @return	Posio (em eligibleMachines) da mquina escolhida (ou -1 se a operao no tiver mquinas elegveis)
+*/
+static int selectMachine_EarliestFinish(Instance* instance, int operation, int ready, int* machineReady, Random* random, int* end)
+{
+	int first = instance->eligibleStart[operation], last = instance->eligibleStart[operation + 1];
+	int* machines = instance->eligibleMachines;
+	int* runtimes = instance->eligibleRuntimes;
+	int best = -1, bestEnd = INT_MAX, k = first;
+
+	if (last - first >= 8 && getInstructionSet() >= INSTRUCTION_SET_AVX2)
+	{
+		k = selectMachine_AVX2(machines, runtimes, first, last, ready, machineReady, random == NULL, &best, &bestEnd);
+	}
+
+	// mquinas que no chegam para um grupo de 8 (ou todas, sem AVX2)
+	for (; k < last; k++)
+	{
+		int start = ready > machineReady[machines[k]] ? ready : machineReady[machines[k]];
+
+		if (best == -1 || start + runtimes[k] < bestEnd || (start + runtimes[k] == bestEnd && random == NULL && runtimes[k] < runtimes[best]))
+		{
+			best = k;
+			bestEnd = start + runtimes[k];
+		}
+	}
+
+	// escolha uniforme entre as mquinas empatadas, pela ordem das posies
+	if (random != NULL && best != -1)
+	{
+		int ties = 0;
+		for (int i = best; i < last; i++)
+		{
+			ties += (ready > machineReady[machines[i]] ? ready : machineReady[machines[i]]) + runtimes[i] == bestEnd;
+		}
+
+		for (int i = best, chosen = ties > 1 ? nextRandom_Int(random, ties) : 0; i < last; i++)
+		{
+			if ((ready > machineReady[machines[i]] ? ready : machineReady[machines[i]]) + runtimes[i] == bestEnd && chosen-- == 0)
+			{
+				best = i;
+				break;
+			}
+		}
+	}
+
+	*end = bestEnd;
+
+	return best;
+}
+
+
+/**
+ * @brief	Construir um plano com uma regra gulosa: as operaes so escalonadas por ordem de posio nos trabalhos,
+ *			cada uma na mquina elegvel em que termina mais cedo
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano a preencher ( limpo antes de construir)
+ * @return	Tempo total do plano (ou -1 se no foi possvel construir)
+*/
+int buildSchedule_Greedy(Instance* instance, Schedule* schedule)
+{
+	if (instance == NULL || schedule == NULL)
+	{
+		return -1;
+	}
+
+	int* jobReady = (int*)calloc(instance->numberOfJobs, sizeof(int));
+	int* machineReady = (int*)calloc(instance->numberOfMachines, sizeof(int));
+	int* nextOperation = (int*)malloc(instance->numberOfJobs * sizeof(int));
+
+	if (jobReady == NULL || machineReady == NULL || nextOperation == NULL)
+	{
+		free(jobReady);
+		free(machineReady);
+		free(nextOperation);
+		return -1;
+	}
+
+	clearSchedule(schedule);
+	memcpy(machineReady, schedule->machineReleaseTime, instance->numberOfMachines * sizeof(int));
+
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		nextOperation[j] = instance->jobStart[j];
+	}
+
+	// em cada ronda  escalonada a prxima operao de cada trabalho
+	while (schedule->numberOfScheduled < instance->numberOfOperations)
+	{
+		for (int j = 0; j < instance->numberOfJobs; j++)
+		{
+			if (nextOperation[j] == instance->jobStart[j + 1])
+			{
+				continue; // todas as operaes do trabalho j foram escalonadas
+			}
+
+			int o = nextOperation[j]++;
+			int ready = schedule->releaseTime[o] > jobReady[j] ? schedule->releaseTime[o] : jobReady[j];
+			int bestEnd;
+			int best = selectMachine_EarliestFinish(instance, o, ready, machineReady, NULL, &bestEnd); // empates resolvidos pelo menor tempo de execuo
+			int bestMachine = instance->eligibleMachines[best];
+
+			insertOperation_AtSchedule(schedule, o, bestMachine, instance->eligibleRuntimes[best], schedule->lastInMachine[bestMachine]);
+			jobReady[j] = bestEnd;
+			machineReady[bestMachine] = bestEnd;
+		}
+	}
+
+	free(jobReady);
+	free(machineReady);
+	free(nextOperation);
+
+	return evaluateSchedule(instance, schedule);
+}
+
+
+/**
+ * @brief	Construir um plano com as mquinas j atribudas: as operaes so escalonadas por ordem de posio nos trabalhos,
+ *			cada uma no fim da sequncia da sua mquina
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano a preencher ( limpo antes de construir)
+ * @param	machines	Mquina (ndice) de cada operao
+ * @param	runtimes	Tempo de execuo de cada operao
+ * @return	Tempo total do plano (ou -1 se no foi possvel construir)
+*/
+int buildSchedule_Assigned(Instance* instance, Schedule* schedule, int* machines, int* runtimes)
+{
+	if (instance == NULL || schedule == NULL || machines == NULL || runtimes == NULL)
+	{
+		return -1;
+	}
+
+	clearSchedule(schedule);
+
+	// em cada ronda  escalonada a prxima operao de cada trabalho
+	for (int position = 0; schedule->numberOfScheduled < instance->numberOfOperations; position++)
+	{
+		for (int j = 0; j < instance->numberOfJobs; j++)
+		{
+			int o = instance->jobStart[j] + position;
+
+			if (o < instance->jobStart[j + 1])
+			{
+				insertOperation_AtSchedule(schedule, o, machines[o], runtimes[o], schedule->lastInMachine[machines[o]]);
+			}
+		}
+	}
+
+	return evaluateSchedule(instance, schedule);
+}
+
+
+/**
+ * @brief	Registar uma construo com limite nas estatsticas
+ * @param	statistics	Estatsticas (ou NULL)
+ * @param	scheduled	Quantidade de operaes escalonadas
+ * @param	total		Quantidade de operaes da instncia
+ * @param	aborted		Se a construo foi abandonada
+*/
+static void recordDecode(DecodeStatistics* statistics, int scheduled, int total, bool aborted)
+{
+	if (statistics == NULL)
+	{
+		return;
+	}
+
+	statistics->decodes++;
+	statistics->operations += total;
+	statistics->scheduled += scheduled;
+
+	if (aborted)
+	{
+		statistics->aborted++;
+		statistics->abortedAtDepth[total > 0 ? (int)((long long)scheduled * DECODE_DEPTH_BUCKETS / total) : 0]++;
+	}
+}
+
+
+/**
+ * @brief	Somar as estatsticas de construes de outra origem (por exemplo, de cada thread) s estatsticas indicadas
+ * @param	destination		Estatsticas onde  feita a soma
+ * @param	source			Estatsticas somadas
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool mergeDecodeStatistics(DecodeStatistics* destination, DecodeStatistics* source)
+{
+	if (destination == NULL || source == NULL)
+	{
+		return false;
+	}
+
+	destination->decodes += source->decodes;
+	destination->aborted += source->aborted;
+	destination->operations += source->operations;
+	destination->scheduled += source->scheduled;
+
+	for (int d = 0; d < DECODE_DEPTH_BUCKETS; d++)
+	{
+		destination->abortedAtDepth[d] += source->abortedAtDepth[d];
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Construir um plano a partir de um cromossoma: cada ocorrncia de um trabalho na sequncia escalona a sua prxima operao,
+ *			no fim da sequncia da mquina indicada pela atribuio
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano a preencher ( limpo antes de construir)
+ * @param	assignment	Posio (em eligibleMachines) da mquina escolhida para cada operao
+ * @param	sequence	ndices dos trabalhos, cada um repetido tantas vezes quantas as suas operaes
+ * @param	cutoff		A construo  abandonada quando o fim de alguma operao mais o trabalho mnimo que falta ao seu trabalho
+ *						chega a cutoff (0 para no limitar)
+ * @param	tails		Trabalho mnimo depois de cada operao, de getJobTails_OfInstance (ou NULL para usar apenas o fim da operao)
+ * @param	statistics	Estatsticas onde a construo  registada (ou NULL)
+ * @return	Tempo total do plano (ou -1 se no foi possvel construir ou se a construo foi abandonada)
+*/
+int buildSchedule_Decoded(Instance* instance, Schedule* schedule, int* assignment, int* sequence, int cutoff, int* tails, DecodeStatistics* statistics)
+{
+	if (instance == NULL || schedule == NULL || assignment == NULL || sequence == NULL)
+	{
+		return -1;
+	}
+
+	int* nextOperation = (int*)malloc(instance->numberOfJobs * sizeof(int));
+	int* jobReady = (int*)calloc(instance->numberOfJobs, sizeof(int));
+	int* machineReady = (int*)malloc(instance->numberOfMachines * sizeof(int));
+
+	if (nextOperation == NULL || jobReady == NULL || machineReady == NULL) // se no houver memria para alocar
+	{
+		free(nextOperation);
+		free(jobReady);
+		free(machineReady);
+		return -1;
+	}
+
+	clearSchedule(schedule);
+	memcpy(nextOperation, instance->jobStart, instance->numberOfJobs * sizeof(int));
+	memcpy(machineReady, schedule->machineReleaseTime, instance->numberOfMachines * sizeof(int));
+
+	bool aborted = false;
+
+	for (int i = 0; i < instance->numberOfOperations && !aborted; i++)
+	{
+		int j = sequence[i];
+		int o = nextOperation[j]++;
+		int machine = instance->eligibleMachines[assignment[o]];
+		int runtime = instance->eligibleRuntimes[assignment[o]];
+
+		// os tempos so acompanhados durante a construo apenas para o limite (o plano  avaliado no fim)
+		int start = jobReady[j] > machineReady[machine] ? jobReady[j] : machineReady[machine];
+		start = schedule->releaseTime[o] > start ? schedule->releaseTime[o] : start;
+		jobReady[j] = machineReady[machine] = start + runtime;
+
+		if (cutoff > 0 && start + runtime + (tails != NULL ? tails[o] : 0) >= cutoff) // o plano j no pode ser melhor do que o limite
+		{
+			aborted = true;
+			break;
+		}
+
+		insertOperation_AtSchedule(schedule, o, machine, runtime, schedule->lastInMachine[machine]);
+	}
+
+	free(nextOperation);
+	free(jobReady);
+	free(machineReady);
+
+	recordDecode(statistics, schedule->numberOfScheduled, instance->numberOfOperations, aborted);
+
+	if (aborted)
+	{
+		return -1;
+	}
+
+	return evaluateSchedule(instance, schedule);
+}
+
+
+/**
+ * @brief	Construir um plano com uma regra gulosa aleatorizada: em cada passo  escolhido um trabalho aleatrio com operaes por escalonar,
+ *			e a sua prxima operao  escalonada na mquina elegvel em que termina mais cedo (empates resolvidos aleatoriamente)
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano a preencher ( limpo antes de construir)
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+ * @param	cutoff		A construo  abandonada quando o fim de alguma operao mais o trabalho mnimo que falta ao seu trabalho
+ *						chega a cutoff (0 para no limitar)
+ * @param	tails		Trabalho mnimo depois de cada operao, de getJobTails_OfInstance (ou NULL para usar apenas o fim da operao)
+ * @param	statistics	Estatsticas onde a construo  registada (ou NULL)
+ * @return	Tempo total do plano (ou -1 se no foi possvel construir ou se a construo foi abandonada)
+*/
+int buildSchedule_Randomized(Instance* instance, Schedule* schedule, Random* random, int cutoff, int* tails, DecodeStatistics* statistics)
+{
+	if (instance == NULL || schedule == NULL || random == NULL)
+	{
+		return -1;
+	}
+
+	int* jobReady = (int*)calloc(instance->numberOfJobs, sizeof(int));
+	int* machineReady = (int*)calloc(instance->numberOfMachines, sizeof(int));
+	int* nextOperation = (int*)malloc(instance->numberOfJobs * sizeof(int));
+	int* activeJobs = (int*)malloc(instance->numberOfJobs * sizeof(int));
+
+	if (jobReady == NULL || machineReady == NULL || nextOperation == NULL || activeJobs == NULL)
+	{
+		free(jobReady);
+		free(machineReady);
+		free(nextOperation);
+		free(activeJobs);
+		return -1;
+	}
+
+	clearSchedule(schedule);
+	memcpy(machineReady, schedule->machineReleaseTime, instance->numberOfMachines * sizeof(int));
+
+	int numberOfActive = 0;
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		nextOperation[j] = instance->jobStart[j];
+
+		if (instance->jobStart[j] < instance->jobStart[j + 1])
+		{
+			activeJobs[numberOfActive++] = j;
+		}
+	}
+
+	bool aborted = false;
+
+	while (numberOfActive > 0 && !aborted)
+	{
+		int chosen = nextRandom_Int(random, numberOfActive);
+		int j = activeJobs[chosen];
+		int o = nextOperation[j]++;
+		int ready = schedule->releaseTime[o] > jobReady[j] ? schedule->releaseTime[o] : jobReady[j];
+		int bestEnd;
+		int best = selectMachine_EarliestFinish(instance, o, ready, machineReady, random, &bestEnd); // escolha uniforme entre empates
+		int bestMachine = instance->eligibleMachines[best];
+		int bestRuntime = instance->eligibleRuntimes[best];
+
+		if (cutoff > 0 && bestEnd + (tails != NULL ? tails[o] : 0) >= cutoff) // o plano j no pode ser melhor do que o limite
+		{
+			aborted = true;
+			break;
+		}
+
+		insertOperation_AtSchedule(schedule, o, bestMachine, bestRuntime, schedule->lastInMachine[bestMachine]);
+		jobReady[j] = bestEnd;
+		machineReady[bestMachine] = bestEnd;
+
+		if (nextOperation[j] == instance->jobStart[j + 1]) // remover o trabalho dos ativos quando est completo
+		{
+			activeJobs[chosen] = activeJobs[--numberOfActive];
+		}
+	}
+
+	free(jobReady);
+	free(machineReady);
+	free(nextOperation);
+	free(activeJobs);
+
+	recordDecode(statistics, schedule->numberOfScheduled, instance->numberOfOperations, aborted);
+
+	if (aborted)
+	{
+		return -1;
+	}
+
+	return evaluateSchedule(instance, schedule);
+}
+
+
+/**
+ * @brief	Mostrar um plano na consola, com a sequncia de operaes de cada mquina
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano a ser mostrado
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool displaySchedule(Instance* instance, Schedule* schedule)
+{
+	if (instance == NULL || schedule == NULL || schedule->numberOfScheduled == 0)
+	{
+		return false;
+	}
+
+	for (int m = 0; m < instance->numberOfMachines; m++)
+	{
+		printf("Mquina %d:", instance->machineIDs[m]);
+
+		for (int o = schedule->firstInMachine[m]; o != -1; o = schedule->nextInMachine[o])
+		{
+			printf(" [j%d o%d %d-%d]", instance->jobIDs[instance->operationJob[o]], instance->operationIDs[o], schedule->startTime[o], schedule->endTime[o]);
+		}
+
+		printf("\n");
+	}
+
+	printf("Tempo total do plano: %d\n", schedule->makespan);
+
+	return true;
+}
+
+
+/**
+ * @brief	Obter clulas de um plano por intervalos de tempo, ordenadas por mquina e tempo inicial, para serem exportadas para um ficheiro
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano avaliado
+ * @return	Clulas que sero exportadas
+*/
+FileCell* getCellsToExport_FromSchedule(Instance* instance, Schedule* schedule)
+{
+	if (instance == NULL || schedule == NULL)
+	{
+		return NULL;
+	}
+
+	FileCell* cells = NULL;
+
+	// percorrer do fim para o incio, porque cada clula  inserida no incio da lista
+	for (int m = instance->numberOfMachines - 1; m >= 0; m--)
+	{
+		for (int o = schedule->lastInMachine[m]; o != -1; o = schedule->previousInMachine[o])
+		{
+			FileCell* cell = newFileCell(instance->machineIDs[m], instance->jobIDs[instance->operationJob[o]], instance->operationIDs[o],
+				schedule->startTime[o], schedule->endTime[o]);
+			cells = insertFileCell_AtStart(cells, cell);
+		}
+	}
+
+	return cells;
+}
+
+
+/**
+ * @brief	Limpar um plano da memria
+ * @param	schedule	Apontador para o plano
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool cleanSchedule(Schedule** schedule)
+{
+	if (schedule == NULL || *schedule == NULL)
+	{
+		return false;
+	}
+
+	free((*schedule)->assignedMachine);
+	free((*schedule)->assignedRuntime);
+	free((*schedule)->startTime);
+	free((*schedule)->endTime);
+	free((*schedule)->releaseTime);
+	free((*schedule)->previousInMachine);
+	free((*schedule)->nextInMachine);
+	free((*schedule)->previousInJob);
+	free((*schedule)->nextInJob);
+	free((*schedule)->order);
+	free((*schedule)->pending);
+	free((*schedule)->firstInMachine);
+	free((*schedule)->lastInMachine);
+	free((*schedule)->machineReleaseTime);
+	free(*schedule);
+
+	*schedule = NULL;
+
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region cromossomas
+
+/**
+ * @brief	Preencher um cromossoma aleatrio: mquina elegvel aleatria para cada operao e sequncia de trabalhos baralhada
+ * @param	instance	Instncia do problema
+ * @param	assignment	Array onde  guardada a posio (em eligibleMachines) da mquina de cada operao
+ * @param	sequence	Array onde  guardada a sequncia de trabalhos
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool fillChromosome_Random(Instance* instance, int* assignment, int* sequence, Random* random)
+{
+	if (instance == NULL || assignment == NULL || sequence == NULL || random == NULL)
+	{
+		return false;
+	}
+
+	int n = instance->numberOfOperations;
+
+	for (int o = 0; o < n; o++)
+	{
+		assignment[o] = instance->eligibleStart[o] + nextRandom_Int(random, instance->eligibleStart[o + 1] - instance->eligibleStart[o]);
+	}
+
+	for (int j = 0, i = 0; j < instance->numberOfJobs; j++)
+	{
+		for (int o = instance->jobStart[j]; o < instance->jobStart[j + 1]; o++)
+		{
+			sequence[i++] = j;
+		}
+	}
+
+	for (int i = n - 1; i > 0; i--)
+	{
+		int other = nextRandom_Int(random, i + 1);
+		int job = sequence[i];
+		sequence[i] = sequence[other];
+		sequence[other] = job;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Obter o cromossoma de um plano completo e avaliado (buildSchedule_Decoded volta a construir as mesmas sequncias nas mquinas)
+ *
+ * A sequncia de trabalhos segue a ordem topolgica calculada por evaluateSchedule, que respeita a ordem de cada mquina.
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano completo e avaliado
+ * @param	assignment	Array onde  guardada a posio (em eligibleMachines) da mquina de cada operao
+ * @param	sequence	Array onde  guardada a sequncia de trabalhos
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool encodeSchedule(Instance* instance, Schedule* schedule, int* assignment, int* sequence)
+{
+	if (instance == NULL || schedule == NULL || assignment == NULL || sequence == NULL || schedule->numberOfScheduled < instance->numberOfOperations)
+	{
+		return false;
+	}
+
+	for (int o = 0; o < instance->numberOfOperations; o++)
+	{
+		int k = instance->eligibleStart[o];
+
+		while (k < instance->eligibleStart[o + 1]
+			&& (instance->eligibleMachines[k] != schedule->assignedMachine[o] || instance->eligibleRuntimes[k] != schedule->assignedRuntime[o]))
+		{
+			k++;
+		}
+
+		if (k == instance->eligibleStart[o + 1])
+		{
+			return false; // a mquina deixou de ser elegvel
+		}
+
+		assignment[o] = k;
+		sequence[o] = instance->operationJob[schedule->order[o]];
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Cruzar dois cromossomas: cruzamento uniforme das atribuies e cruzamento por subconjunto de trabalhos (POX) das sequncias
+ * @param	instance			Instncia do problema
+ * @param	firstAssignment		Atribuio do primeiro progenitor
+ * @param	firstSequence		Sequncia do primeiro progenitor
+ * @param	secondAssignment	Atribuio do segundo progenitor
+ * @param	secondSequence		Sequncia do segundo progenitor
+ * @param	childAssignment		Array onde  guardada a atribuio do descendente
+ * @param	childSequence		Array onde  guardada a sequncia do descendente
+ * @param	keepJob				Memria auxiliar (tamanho igual  quantidade de trabalhos)
+ * @param	random				Gerador de nmeros pseudo-aleatrios
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool crossoverChromosomes(Instance* instance, int* firstAssignment, int* firstSequence, int* secondAssignment, int* secondSequence,
+	int* childAssignment, int* childSequence, bool* keepJob, Random* random)
+{
+	if (instance == NULL || firstAssignment == NULL || firstSequence == NULL || secondAssignment == NULL || secondSequence == NULL
+		|| childAssignment == NULL || childSequence == NULL || keepJob == NULL || random == NULL)
+	{
+		return false;
+	}
+
+	int n = instance->numberOfOperations;
+
+	for (int o = 0; o < n; o++)
+	{
+		childAssignment[o] = nextRandom_Int(random, 2) == 0 ? firstAssignment[o] : secondAssignment[o];
+	}
+
+	// os trabalhos escolhidos mantm as posies do primeiro progenitor, os restantes seguem a ordem do segundo
+	for (int j = 0; j < instance->numberOfJobs; j++)
+	{
+		keepJob[j] = nextRandom_Int(random, 2) == 0;
+	}
+
+	int next = 0;
+
+	for (int i = 0; i < n; i++)
+	{
+		if (keepJob[firstSequence[i]])
+		{
+			childSequence[i] = firstSequence[i];
+			continue;
+		}
+
+		while (keepJob[secondSequence[next]])
+		{
+			next++;
+		}
+
+		childSequence[i] = secondSequence[next++];
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Mutar um cromossoma: mudar a mquina de uma operao aleatria e trocar duas posies aleatrias da sequncia
+ * @param	instance	Instncia do problema
+ * @param	assignment	Atribuio ( alterada)
+ * @param	sequence	Sequncia ( alterada)
+ * @param	random		Gerador de nmeros pseudo-aleatrios
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool mutateChromosome(Instance* instance, int* assignment, int* sequence, Random* random)
+{
+	if (instance == NULL || assignment == NULL || sequence == NULL || random == NULL)
+	{
+		return false;
+	}
+
+	int n = instance->numberOfOperations;
+	int o = nextRandom_Int(random, n);
+
+	assignment[o] = instance->eligibleStart[o] + nextRandom_Int(random, instance->eligibleStart[o + 1] - instance->eligibleStart[o]);
+
+	int a = nextRandom_Int(random, n), b = nextRandom_Int(random, n);
+	int job = sequence[a];
+	sequence[a] = sequence[b];
+	sequence[b] = job;
+
+	return true;
+}
+
+#pragma endregion
+
+
+#pragma region avaliao em lote
+
+/**
+ * @brief	Escalonar, em todas as vias, a operao seguinte do passo indicado das sequncias (verso escalar)
+ *
+ * Todos os arrays esto intercalados por via: o valor de um trabalho, operao ou mquina x na via l est na posio x * DECODE_LANES + l.
+ * @param	step			Posio nas sequncias
+ * @param	sequences		Sequncias intercaladas
+ * @param	assignments		Atribuies intercaladas
+ * @param	machines		Mquinas elegveis da instncia
+ * @param	runtimes		Tempos de execuo das mquinas elegveis da instncia
+ * @param	nextOperation	Prxima operao de cada trabalho
+ * @param	jobReady		Tempo em que cada trabalho fica disponvel
+ * @param	machineReady	Tempo em que cada mquina fica disponvel
+ * @param	operations		Array onde  guardada a operao escalonada em cada via
+ * @param	chosen			Array onde  guardada a mquina escolhida em cada via
+*/
+static void decodeStep_Scalar(int step, int* sequences, int* assignments, int* machines, int* runtimes, int* nextOperation, int* jobReady, int* machineReady,
+	int* operations, int* chosen)
+{
+	for (int l = 0; l < DECODE_LANES; l++)
+	{
+		int job = sequences[step * DECODE_LANES + l] * DECODE_LANES + l;
+		int o = nextOperation[job]++;
+		int k = assignments[o * DECODE_LANES + l];
+		int machine = machines[k] * DECODE_LANES + l;
+		int start = jobReady[job] > machineReady[machine] ? jobReady[job] : machineReady[machine];
+
+		jobReady[job] = machineReady[machine] = start + runtimes[k];
+		operations[l] = o;
+		chosen[l] = machines[k];
+	}
+}
+
+
+/**
+ * @brief	Avaliar vrios cromossomas de uma vez, sem construir os planos
+ *
+ * Os cromossomas so descodificados em grupos de DECODE_LANES, um por via: em cada passo, os tempos de disponibilidade dos trabalhos
+ * e das mquinas de todas as vias avanam em conjunto. O passo usa AVX-512 ou AVX2 se o processador os suportar
+ * (detetado quando o programa corre), ou a verso escalar, sempre com os mesmos resultados.
+ * Os resultados so os de buildSchedule_Decoded num plano sem tempos mnimos de incio (tempo total e impresso digital).
+ * @param	instance		Instncia do problema
+ * @param	assignments		Atribuio de cada cromossoma
+ * @param	sequences		Sequncia de cada cromossoma
+ * @param	count			Quantidade de cromossomas
+ * @param	makespans		Array onde  guardado o tempo total de cada cromossoma
+ * @param	fingerprints	Array onde  guardada a impresso digital de cada cromossoma (ou NULL para no calcular)
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool evaluateChromosomes_Batch(Instance* instance, int** assignments, int** sequences, int count, int* makespans, unsigned long long* fingerprints)
+{
+	if (instance == NULL || assignments == NULL || sequences == NULL || makespans == NULL || count < 0)
+	{
+		return false;
+	}
+
+	int n = instance->numberOfOperations;
+	int numberOfJobs = instance->numberOfJobs, numberOfMachines = instance->numberOfMachines;
+	InstructionSet instructionSet = getInstructionSet();
+
+	int* interleavedSequences = (int*)malloc(n * DECODE_LANES * sizeof(int));
+	int* interleavedAssignments = (int*)malloc(n * DECODE_LANES * sizeof(int));
+	int* nextOperation = (int*)malloc(numberOfJobs * DECODE_LANES * sizeof(int));
+	int* jobReady = (int*)malloc(numberOfJobs * DECODE_LANES * sizeof(int));
+	int* machineReady = (int*)malloc(numberOfMachines * DECODE_LANES * sizeof(int));
+	int* lastInMachine = (int*)malloc(numberOfMachines * DECODE_LANES * sizeof(int));
+
+	if (interleavedSequences == NULL || interleavedAssignments == NULL || nextOperation == NULL || jobReady == NULL || machineReady == NULL || lastInMachine == NULL)
+	{
+		free(interleavedSequences);
+		free(interleavedAssignments);
+		free(nextOperation);
+		free(jobReady);
+		free(machineReady);
+		free(lastInMachine);
+		return false;
+	}
+
+	for (int first = 0; first < count; first += DECODE_LANES)
+	{
+		// as vias a mais do ltimo grupo repetem o ltimo cromossoma (os resultados so ignorados)
+		for (int l = 0; l < DECODE_LANES; l++)
+		{
+			int c = first + l < count ? first + l : count - 1;
+
+			for (int i = 0; i < n; i++)
+			{
+				interleavedSequences[i * DECODE_LANES + l] = sequences[c][i];
+				interleavedAssignments[i * DECODE_LANES + l] = assignments[c][i];
+			}
+
+			for (int j = 0; j < numberOfJobs; j++)
+			{
+				nextOperation[j * DECODE_LANES + l] = instance->jobStart[j];
+				jobReady[j * DECODE_LANES + l] = 0;
+			}
+
+			for (int m = 0; m < numberOfMachines; m++)
+			{
+				machineReady[m * DECODE_LANES + l] = 0;
+				lastInMachine[m * DECODE_LANES + l] = -1;
+			}
+		}
+
+		unsigned long long laneFingerprints[DECODE_LANES] = { 0 };
+		int operations[DECODE_LANES], chosen[DECODE_LANES];
+
+		for (int i = 0; i < n; i++)
+		{
+			if (instructionSet == INSTRUCTION_SET_AVX512)
+			{
+				decodeStep_AVX512(i, interleavedSequences, interleavedAssignments, instance->eligibleMachines, instance->eligibleRuntimes, nextOperation, jobReady,
+					machineReady, operations, chosen);
+			}
+			else if (instructionSet == INSTRUCTION_SET_AVX2)
+			{
+				decodeStep_AVX2(i, interleavedSequences, interleavedAssignments, instance->eligibleMachines, instance->eligibleRuntimes, nextOperation, jobReady,
+					machineReady, operations, chosen);
+			}
+			else
+			{
+				decodeStep_Scalar(i, interleavedSequences, interleavedAssignments, instance->eligibleMachines, instance->eligibleRuntimes, nextOperation, jobReady,
+					machineReady, operations, chosen);
+			}
+
+			// as chaves de Zobrist so calculadas via a via (cada operao fica no fim da sequncia da sua mquina)
+			if (fingerprints != NULL)
+			{
+				for (int l = 0; l < DECODE_LANES; l++)
+				{
+					int* last = &lastInMachine[chosen[l] * DECODE_LANES + l];
+
+					laneFingerprints[l] ^= getZobristKey(operations[l], chosen[l], *last);
+					*last = operations[l];
+				}
+			}
+		}
+
+		// o tempo total  o maior tempo de disponibilidade dos trabalhos depois da ltima operao
+		for (int l = 0; l < DECODE_LANES && first + l < count; l++)
+		{
+			int makespan = 0;
+
+			for (int j = 0; j < numberOfJobs; j++)
+			{
+				makespan = jobReady[j * DECODE_LANES + l] > makespan ? jobReady[j * DECODE_LANES + l] : makespan;
+			}
+
+			makespans[first + l] = makespan;
+
+			if (fingerprints != NULL)
+			{
+				fingerprints[first + l] = laneFingerprints[l];
+			}
+		}
+	}
+
+	free(interleavedSequences);
+	free(interleavedAssignments);
+	free(nextOperation);
+	free(jobReady);
+	free(machineReady);
+	free(lastInMachine);
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,200 @@
+/**
+ * @brief	Ficheiro com todas as assinaturas globais necessrios para o escalonamento com a instncia compacta do problema.
+ * @file	scheduling.h
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+
+#ifndef SCHEDULING
+#define SCHEDULING 1
+
+#pragma region instncias
+
+Instance* newInstance(Job* jobs, Machine* machines, Operation* operations, ExecutionNode* table[]);
+Instance* newInstance_Arrays(int* jobIDs, int numberOfJobs, int* machineIDs, int numberOfMachines, int* operations, int numberOfOperations, int* executions, int numberOfExecutions);
+Instance* newInstance_Subset(Instance* instance, int* operations, int count);
+int getRuntime_AtInstance(Instance* instance, int operation, int machine);
+bool getJobTails_OfInstance(Instance* instance, int* tails);
+int getOperationIndex_AtInstance(Instance* instance, int operationID);
+int getMachineIndex_AtInstance(Instance* instance, int machineID);
+bool setRuntime_AtInstance(Instance* instance, int operation, int machine, int runtime);
+bool removeMachine_AtInstance(Instance* instance, int machine);
+int appendJob_AtInstance(Instance* instance, JobArrival* arrival);
+bool cleanInstance(Instance** instance);
+
+#pragma endregion
+
+
+#pragma region ficheiros de instncias
+
+Instance* readInstance_Text(char jobsFileName[], char machinesFileName[], char operationsFileName[], char executionsFileName[]);
+Instance* readInstance_Benchmark(char fileName[]);
+Instance* readInstance_Binary(char fileName[]);
+bool writeInstance_Binary(char fileName[], Instance* instance);
+
+#pragma endregion
+
+
+#pragma region planos por intervalos de tempo
+
+Schedule* newSchedule(Instance* instance);
+bool copySchedule(Schedule* destination, Schedule* source);
+bool clearSchedule(Schedule* schedule);
+bool resizeSchedule(Schedule* schedule, int numberOfOperations);
+bool insertOperation_AtSchedule(Schedule* schedule, int operation, int machine, int runtime, int previous);
+bool removeOperation_AtSchedule(Schedule* schedule, int operation);
+int evaluateSchedule(Instance* instance, Schedule* schedule);
+bool getTails_OfSchedule(Schedule* schedule, int* tails);
+unsigned long long getFingerprint_OfSchedule(Schedule* schedule);
+int buildSchedule_Greedy(Instance* instance, Schedule* schedule);
+int buildSchedule_Assigned(Instance* instance, Schedule* schedule, int* machines, int* runtimes);
+int buildSchedule_Decoded(Instance* instance, Schedule* schedule, int* assignment, int* sequence, int cutoff, int* tails, DecodeStatistics* statistics);
+int buildSchedule_Randomized(Instance* instance, Schedule* schedule, Random* random, int cutoff, int* tails, DecodeStatistics* statistics);
+bool mergeDecodeStatistics(DecodeStatistics* destination, DecodeStatistics* source);
+bool displaySchedule(Instance* instance, Schedule* schedule);
+FileCell* getCellsToExport_FromSchedule(Instance* instance, Schedule* schedule);
+bool cleanSchedule(Schedule** schedule);
+
+#pragma endregion
+
+
+#pragma region exportao de planos
+
+PlanExporter* newPlanExporter(char fileName[], PlanFormat format);
+bool exportSchedule(PlanExporter* exporter, Instance* instance, Schedule* schedule);
+bool cleanPlanExporter(PlanExporter** exporter);
+
+#pragma endregion
+
+
+#pragma region cromossomas
+
+bool fillChromosome_Random(Instance* instance, int* assignment, int* sequence, Random* random);
+bool encodeSchedule(Instance* instance, Schedule* schedule, int* assignment, int* sequence);
+bool crossoverChromosomes(Instance* instance, int* firstAssignment, int* firstSequence, int* secondAssignment, int* secondSequence,
+	int* childAssignment, int* childSequence, bool* keepJob, Random* random);
+bool mutateChromosome(Instance* instance, int* assignment, int* sequence, Random* random);
+
+#pragma endregion
+
+
+#pragma region avaliao em lote
+
+bool evaluateChromosomes_Batch(Instance* instance, int** assignments, int** sequences, int count, int* makespans, unsigned long long* fingerprints);
+void decodeStep_AVX2(int step, int* sequences, int* assignments, int* machines, int* runtimes, int* nextOperation, int* jobReady, int* machineReady,
+	int* operations, int* chosen);
+void decodeStep_AVX512(int step, int* sequences, int* assignments, int* machines, int* runtimes, int* nextOperation, int* jobReady, int* machineReady,
+	int* operations, int* chosen);
+
+#pragma endregion
+
+
+#pragma region impresses digitais
+
+FingerprintSet* newFingerprintSet(int memory);
+bool insertFingerprint_AtSet(FingerprintSet* set, unsigned long long fingerprint);
+bool containsFingerprint_AtSet(FingerprintSet* set, unsigned long long fingerprint);
+bool clearFingerprintSet(FingerprintSet* set);
+bool cleanFingerprintSet(FingerprintSet** set);
+
+#pragma endregion
+
+
+#pragma region iterated greedy
+
+int getBestPosition_ForOperation(Instance* instance, Schedule* schedule, int operation, int frozenTime, int* tails, int* machine, int* runtime, int* previous);
+int reinsertOperation_AtBestPosition(Instance* instance, Schedule* schedule, int operation, int frozenTime, int* tails);
+IteratedGreedySearch* startIteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, unsigned long long seed);
+bool restartIteratedGreedy(IteratedGreedySearch* search, Schedule* schedule);
+int continueIteratedGreedy(IteratedGreedySearch* search, Schedule* best, long long deadline, int maxIterations, volatile int* cutoff, int* jobTails,
+	IncumbentCallback callback, void* context);
+bool cleanIteratedGreedy(IteratedGreedySearch** search);
+int improveSchedule_IteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, long long deadline, int maxIterations,
+	unsigned long long seed, IncumbentCallback callback, void* context);
+int solveSchedule_IteratedGreedy(Instance* instance, Schedule* best, int destroySize, float temperatureFactor, long long timeLimit, int maxIterations, unsigned long long seed);
+
+#pragma endregion
+
+
+#pragma region resoluo com tempo limite
+
+int solveSchedule_Anytime(Instance* instance, Schedule* best, long long deadline, IncumbentCallback callback, void* context, unsigned long long seed);
+bool exportIncumbent(Instance* instance, Schedule* incumbent, void* context);
+
+#pragma endregion
+
+
+#pragma region portflio de algoritmos em paralelo
+
+int solveSchedule_Portfolio(Instance* instance, Schedule* best, int numberOfThreads, long long deadline, IncumbentCallback callback, void* context, unsigned long long seed,
+	DecodeStatistics* statistics);
+int improveSchedule_Engine(Instance* instance, Schedule* best, Schedule* candidate, SolverEngine engine, int iterations, int cutoff, int* tails,
+	DecodeStatistics* statistics, Random* random);
+int solveSchedule_Deterministic(Instance* instance, Schedule* best, int numberOfThreads, int numberOfEpochs, int iterationsPerEpoch, long long deadline,
+	IncumbentCallback callback, void* context, unsigned long long seed);
+
+#pragma endregion
+
+
+#pragma region reparao de planos
+
+int propagateTimes_AtSchedule(Instance* instance, Schedule* schedule, int operation, int* affected);
+int polishSchedule_Region(Instance* instance, Schedule* schedule, int* region, int regionSize);
+int repairSchedule_Runtime(Instance* instance, Schedule* schedule, int operationID, int machineID, int runtime, bool polish);
+int repairSchedule_MachineRemoval(Instance* instance, Schedule* schedule, int machineID, int failureTime);
+
+#pragma endregion
+
+
+#pragma region escalonamento online
+
+OnlineScheduler* startOnlineScheduler(Instance* instance, Schedule* schedule, IncumbentCallback callback, void* context);
+int insertJob_Online(OnlineScheduler* online, JobArrival* arrival);
+int readArrivals_Online(OnlineScheduler* online, char fileName[]);
+bool cleanOnlineScheduler(OnlineScheduler** online);
+
+#pragma endregion
+
+
+#pragma region horizonte deslizante
+
+int solveSchedule_RollingHorizon(Instance* instance, Schedule* result, int windowSize, int overlap, SolverEngine engine, int iterationsPerWindow,
+	unsigned long long seed, IncumbentCallback callback, void* context);
+
+#pragma endregion
+
+
+#pragma region atribuio de mquinas
+
+int assignMachines_LoadBalanced(Instance* instance, int* machines, int* runtimes);
+int selectMachine_AVX2(int* machines, int* runtimes, int first, int last, int ready, int* machineReady, bool tieByRuntime, int* best, int* bestEnd);
+
+#pragma endregion
+
+
+#pragma region frente de Pareto
+
+ParetoArchive* newParetoArchive(Instance* instance, int capacity);
+bool insertSchedule_AtArchive(ParetoArchive* archive, Instance* instance, Schedule* schedule);
+int solveSchedule_Pareto(Instance* instance, ParetoArchive* archive, int populationSize, int generations, unsigned long long seed);
+bool cleanParetoArchive(ParetoArchive** archive);
+
+#pragma endregion
+
+
+#pragma region algoritmo memtico
+
+int solveSchedule_Memetic(Instance* instance, Schedule* best, int populationSize, int generations, int numberOfThreads, long long deadline,
+	IncumbentCallback callback, void* context, unsigned long long seed);
+
+#pragma endregion
+
+
+#pragma region shifting bottleneck
+
+int solveSchedule_ShiftingBottleneck(Instance* instance, Schedule* schedule);
+
+#pragma endregion
+
+#endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @brief	Ficheiro com os ncleos vetoriais AVX2, compilados s para estas funes e chamados apenas se o processador suportar AVX2.
+ * @file	simd-avx2.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+ *
+ * No Visual Studio, este ficheiro  compilado com /arch:AVX2 (e o resto do projeto sem instrues vetoriais obrigatrias);
+ * no GCC e no Clang, cada funo indica o conjunto de instrues que usa.
+*/
+
+#include <stdio.h>
+#include <limits.h>
+#include <immintrin.h>
+#include "data-types.h"
+#include "scheduling.h"
+
+#if defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+
+#pragma region avaliao em lote
+
+/**
+ * @brief	Escalonar, em todas as vias, a operao seguinte do passo indicado das sequncias (AVX2, 8 vias de cada vez, com recolha; a escrita  escalar)
+ *
+ * Os parmetros so os de decodeStep_Scalar (schedule.c).
+*/
+TARGET_AVX2 void decodeStep_AVX2(int step, int* sequences, int* assignments, int* machines, int* runtimes, int* nextOperation, int* jobReady, int* machineReady,
+	int* operations, int* chosen)
+{
+	for (int half = 0; half < DECODE_LANES; half += 8)
+	{
+		__m256i lanes = _mm256_setr_epi32(half, half + 1, half + 2, half + 3, half + 4, half + 5, half + 6, half + 7);
+
+		// x * DECODE_LANES + l, com DECODE_LANES = 16
+		__m256i job = _mm256_add_epi32(_mm256_slli_epi32(_mm256_loadu_si256((__m256i*)(sequences + step * DECODE_LANES + half)), 4), lanes);
+		__m256i o = _mm256_i32gather_epi32(nextOperation, job, 4);
+		__m256i k = _mm256_i32gather_epi32(assignments, _mm256_add_epi32(_mm256_slli_epi32(o, 4), lanes), 4);
+		__m256i m = _mm256_i32gather_epi32(machines, k, 4);
+		__m256i machine = _mm256_add_epi32(_mm256_slli_epi32(m, 4), lanes);
+		__m256i start = _mm256_max_epi32(_mm256_i32gather_epi32(jobReady, job, 4), _mm256_i32gather_epi32(machineReady, machine, 4));
+		__m256i end = _mm256_add_epi32(start, _mm256_i32gather_epi32(runtimes, k, 4));
+
+		int jobs[8], slots[8], ends[8];
+
+		_mm256_storeu_si256((__m256i*)jobs, job);
+		_mm256_storeu_si256((__m256i*)slots, machine);
+		_mm256_storeu_si256((__m256i*)ends, end);
+		_mm256_storeu_si256((__m256i*)(operations + half), o);
+		_mm256_storeu_si256((__m256i*)(chosen + half), m);
+
+		for (int l = 0; l < 8; l++)
+		{
+			nextOperation[jobs[l]] = operations[half + l] + 1;
+			jobReady[jobs[l]] = ends[l];
+			machineReady[slots[l]] = ends[l];
+		}
+	}
+}
+
+#pragma endregion
+
+
+#pragma region atribuio de mquinas
+
+/**
+ * @brief	Avaliar as mquinas elegveis de uma operao 8 de cada vez (recolha dos tempos das mquinas, mximo, soma e mnimo por via)
+ *
+ * Em cada via fica a melhor mquina por (fim, tempo de execuo se os empates forem resolvidos por ele, posio); no final, a melhor das vias
+ *  comparada com a escolha recebida. As mquinas que no chegam para um grupo de 8 ficam para quem chama.
+ * @param	machines		Mquinas elegveis da instncia
+ * @param	runtimes		Tempos de execuo das mquinas elegveis da instncia
+ * @param	first			Primeira posio das mquinas elegveis da operao
+ * @param	last			Posio seguinte  ltima mquina elegvel da operao
+ * @param	ready			Tempo a partir do qual a operao pode comear
+ * @param	machineReady	Tempo em que cada mquina fica disponvel
+ * @param	tieByRuntime	Resolver os empates pelo menor tempo de execuo (se no, pela menor posio)
+ * @param	best			Apontador para a posio da melhor mquina at agora (ou -1), atualizado
+ * @param	bestEnd			Apontador para o fim da operao na melhor mquina at agora, atualizado
+ * @return	Primeira posio que no foi avaliada
+*/
+TARGET_AVX2 int selectMachine_AVX2(int* machines, int* runtimes, int first, int last, int ready, int* machineReady, bool tieByRuntime, int* best, int* bestEnd)
+{
+	__m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i readyVector = _mm256_set1_epi32(ready);
+	__m256i bestEnds = _mm256_set1_epi32(INT_MAX), bestRuntimes = _mm256_set1_epi32(INT_MAX), bestPositions = _mm256_set1_epi32(INT_MAX);
+	int k = first;
+
+	for (; k + 8 <= last; k += 8)
+	{
+		__m256i runtime = _mm256_loadu_si256((__m256i*)(runtimes + k));
+		__m256i ends = _mm256_add_epi32(_mm256_max_epi32(_mm256_i32gather_epi32(machineReady, _mm256_loadu_si256((__m256i*)(machines + k)), 4), readyVector), runtime);
+
+		__m256i better = _mm256_cmpgt_epi32(bestEnds, ends);
+		if (tieByRuntime)
+		{
+			better = _mm256_or_si256(better, _mm256_and_si256(_mm256_cmpeq_epi32(bestEnds, ends), _mm256_cmpgt_epi32(bestRuntimes, runtime)));
+		}
+
+		bestEnds = _mm256_blendv_epi8(bestEnds, ends, better);
+		bestRuntimes = _mm256_blendv_epi8(bestRuntimes, runtime, better);
+		bestPositions = _mm256_blendv_epi8(bestPositions, _mm256_add_epi32(_mm256_set1_epi32(k), lanes), better);
+	}
+
+	int laneEnds[8], laneRuntimes[8], lanePositions[8];
+	_mm256_storeu_si256((__m256i*)laneEnds, bestEnds);
+	_mm256_storeu_si256((__m256i*)laneRuntimes, bestRuntimes);
+	_mm256_storeu_si256((__m256i*)lanePositions, bestPositions);
+
+	for (int l = 0; l < 8; l++)
+	{
+		if (*best == -1 || laneEnds[l] < *bestEnd || (laneEnds[l] == *bestEnd && tieByRuntime && laneRuntimes[l] < runtimes[*best])
+			|| (laneEnds[l] == *bestEnd && (!tieByRuntime || laneRuntimes[l] == runtimes[*best]) && lanePositions[l] < *best))
+		{
+			*best = lanePositions[l];
+			*bestEnd = laneEnds[l];
+		}
+	}
+
+	return k;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+ * @brief	Ficheiro com os ncleos vetoriais AVX-512, compilados s para estas funes e chamados apenas se o processador suportar AVX-512.
+ * @file	simd-avx512.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+ *
+ * No Visual Studio, este ficheiro  compilado com /arch:AVX512 (e o resto do projeto sem instrues vetoriais obrigatrias);
+ * no GCC e no Clang, cada funo indica o conjunto de instrues que usa.
+*/
+
+#include <stdio.h>
+#include <immintrin.h>
+#include "data-types.h"
+#include "scheduling.h"
+
+#if defined(__GNUC__)
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define TARGET_AVX512
+#endif
+
+
+#pragma region avaliao em lote
+
+/**
+ * @brief	Escalonar, em todas as vias, a operao seguinte do passo indicado das sequncias (AVX-512, com recolha e disperso)
+ *
+ * Os parmetros so os de decodeStep_Scalar (schedule.c). Numa via, cada trabalho e mquina tem um ndice diferente,
+ * pelo que a disperso no tem conflitos.
+*/
+TARGET_AVX512 void decodeStep_AVX512(int step, int* sequences, int* assignments, int* machines, int* runtimes, int* nextOperation, int* jobReady, int* machineReady,
+	int* operations, int* chosen)
+{
+	__m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+	// x * DECODE_LANES + l, com DECODE_LANES = 16
+	__m512i job = _mm512_add_epi32(_mm512_slli_epi32(_mm512_loadu_si512(sequences + step * DECODE_LANES), 4), lanes);
+	__m512i o = _mm512_i32gather_epi32(job, nextOperation, 4);
+	__m512i k = _mm512_i32gather_epi32(_mm512_add_epi32(_mm512_slli_epi32(o, 4), lanes), assignments, 4);
+	__m512i m = _mm512_i32gather_epi32(k, machines, 4);
+	__m512i machine = _mm512_add_epi32(_mm512_slli_epi32(m, 4), lanes);
+	__m512i start = _mm512_max_epi32(_mm512_i32gather_epi32(job, jobReady, 4), _mm512_i32gather_epi32(machine, machineReady, 4));
+	__m512i end = _mm512_add_epi32(start, _mm512_i32gather_epi32(k, runtimes, 4));
+
+	_mm512_i32scatter_epi32(nextOperation, job, _mm512_add_epi32(o, _mm512_set1_epi32(1)), 4);
+	_mm512_i32scatter_epi32(jobReady, job, end, 4);
+	_mm512_i32scatter_epi32(machineReady, machine, end, 4);
+	_mm512_storeu_si512(operations, o);
+	_mm512_storeu_si512(chosen, m);
+}
+
+#pragma endregion
\ No newline at end of file
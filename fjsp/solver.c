@@ -0,0 +1,78 @@
+/**
+ * @brief	Ficheiro com todas as funes relativas  resoluo do escalonamento com tempo limite e publicao dos melhores planos.
+ * @file	solver.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "data-types.h"
+#include "lists.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+#pragma region resoluo com tempo limite
+
+/**
+ * @brief	Resolver o escalonamento at um instante limite, publicando cada plano melhor assim que  encontrado
+ *
+ * O primeiro plano  construdo pela regra gulosa (em tempo linear no tamanho da instncia) e publicado de imediato,
+ * para existir sempre um plano vlido mesmo com prazos muito curtos. Depois  melhorado por iterated greedy at ao prazo.
+ * @param	instance	Instncia do problema
+ * @param	best		Plano onde  guardado o melhor plano encontrado
+ * @param	deadline	Instante (de getCurrentTime) em que a procura termina
+ * @param	callback	Funo chamada com cada novo melhor plano (ou NULL), que pode devolver false para terminar a procura
+ * @param	context		Dados passados  funo callback
+ * @param	seed		Semente do gerador de nmeros pseudo-aleatrios
+ * @return	Tempo total do melhor plano (ou -1 se no foi possvel escalonar)
+*/
+int solveSchedule_Anytime(Instance* instance, Schedule* best, long long deadline, IncumbentCallback callback, void* context, unsigned long long seed)
+{
+	if (instance == NULL || best == NULL)
+	{
+		return -1;
+	}
+
+	if (buildSchedule_Greedy(instance, best) < 0)
+	{
+		return -1;
+	}
+
+	if (callback != NULL && !callback(instance, best, context))
+	{
+		return best->makespan;
+	}
+
+	if (getCurrentTime() >= deadline) // o prazo terminou durante a construo do plano inicial
+	{
+		return best->makespan;
+	}
+
+	improveSchedule_IteratedGreedy(instance, best, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, deadline, 0, seed, callback, context);
+
+	return best->makespan;
+}
+
+
+/**
+ * @brief	Publicar um novo melhor plano: mostrar o tempo total na consola e exportar o plano para um ficheiro
+ * @param	instance	Instncia do problema
+ * @param	incumbent	Novo melhor plano
+ * @param	context		Exportador de planos (PlanExporter), com o ficheiro e o formato
+ * @return	Booleano para continuar a procura (sempre true)
+*/
+bool exportIncumbent(Instance* instance, Schedule* incumbent, void* context)
+{
+	printf("Novo plano com tempo total %d.\n", incumbent->makespan);
+
+	if (context != NULL)
+	{
+		exportSchedule((PlanExporter*)context, instance, incumbent);
+	}
+
+	return true;
+}
+
+#pragma endregion
\ No newline at end of file
@@ -5,12 +5,35 @@
  * @date	15/08/2024
 */
 
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L // funes POSIX (clock_gettime, fileno, fsync...), que no so declaradas com -std=c11
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
 #include "data-types.h"
+#include "concurrency.h"
 #include "utils.h"
 
 
+// conjunto de instrues detetado na primeira chamada de getInstructionSet (-1 enquanto no foi detetado)
+static volatile int detectedInstructionSet = -1;
+
+
 /**
  * @brief	Remover a nova linha do final de uma string, se existir
  * @param	text	Texto
@@ -28,4 +51,298 @@ bool removeNewLine(char* text)
 	}
 
 	return removed;
+}
+
+/**
+ * @brief	Obter o tempo atual de um relgio montono
+ * @return	Tempo atual em milissegundos
+*/
+long long getCurrentTime()
+{
+#ifdef _WIN32
+	return (long long)GetTickCount64();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#endif
+}
+
+
+/**
+ * @brief	Criar novo gerador de nmeros pseudo-aleatrios
+ * @param	seed	Semente do gerador
+ * @return	Gerador criado
+*/
+Random newRandom(unsigned long long seed)
+{
+	Random new;
+
+	new.seed = seed;
+	new.counter = 0;
+
+	return new;
+}
+
+
+/**
+ * @brief	Obter o prximo nmero pseudo-aleatrio (splitmix64), calculado apenas a partir da semente e do contador
+ * @param	random	Apontador para o gerador
+ * @return	Nmero de 64 bits
+*/
+unsigned long long nextRandom(Random* random)
+{
+	unsigned long long z = random->seed + (++random->counter) * 0x9E3779B97F4A7C15ULL;
+
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+	return z ^ (z >> 31);
+}
+
+
+/**
+ * @brief	Obter um nmero inteiro pseudo-aleatrio num intervalo
+ * @param	random	Apontador para o gerador
+ * @param	bound	Limite superior (exclusivo)
+ * @return	Nmero entre 0 e bound - 1
+*/
+int nextRandom_Int(Random* random, int bound)
+{
+	if (bound <= 0)
+	{
+		return 0;
+	}
+
+	return (int)(nextRandom(random) % (unsigned long long)bound);
+}
+
+
+/**
+ * @brief	Obter um nmero real pseudo-aleatrio
+ * @param	random	Apontador para o gerador
+ * @return	Nmero entre 0 (inclusivo) e 1 (exclusivo)
+*/
+float nextRandom_Float(Random* random)
+{
+	return (float)(nextRandom(random) >> 40) / (float)(1ULL << 24);
+}
+
+
+/**
+ * @brief	Mapear um ficheiro em memria apenas para leitura, sem copiar o contedo
+ * @param	fileName	Nome do ficheiro
+ * @param	file		Apontador onde  guardado o ficheiro mapeado
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool mapFile(char fileName[], MappedFile* file)
+{
+	if (fileName == NULL || file == NULL)
+	{
+		return false;
+	}
+
+	file->data = NULL;
+	file->size = 0;
+
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (handle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size))
+	{
+		CloseHandle(handle);
+		return false;
+	}
+
+	file->size = (long long)size.QuadPart;
+
+	if (file->size > 0)
+	{
+		// a vista continua vlida depois de fechar os handles do ficheiro e do mapeamento
+		HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+		file->data = mapping != NULL ? (char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+
+		if (mapping != NULL)
+		{
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(handle);
+#else
+	int descriptor = open(fileName, O_RDONLY);
+	if (descriptor == -1)
+	{
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(descriptor, &status) == -1)
+	{
+		close(descriptor);
+		return false;
+	}
+
+	file->size = (long long)status.st_size;
+
+	if (file->size > 0)
+	{
+		void* data = mmap(NULL, (size_t)file->size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		file->data = data != MAP_FAILED ? (char*)data : NULL;
+
+		if (file->data != NULL)
+		{
+#ifdef POSIX_MADV_SEQUENTIAL // s existe se as extenses POSIX estiverem disponveis (por exemplo, no existe com -std=c11)
+			posix_madvise(file->data, (size_t)file->size, POSIX_MADV_SEQUENTIAL); // o ficheiro  lido do incio ao fim
+#endif
+		}
+	}
+
+	close(descriptor);
+#endif
+
+	if (file->size > 0 && file->data == NULL)
+	{
+		file->size = 0;
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief	Desfazer o mapeamento de um ficheiro em memria
+ * @param	file	Ficheiro mapeado
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool unmapFile(MappedFile* file)
+{
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	if (file->data != NULL)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(file->data);
+#else
+		munmap(file->data, (size_t)file->size);
+#endif
+	}
+
+	file->data = NULL;
+	file->size = 0;
+
+	return true;
+}
+
+
+/**
+ * @brief	Forar a escrita no disco de tudo o que foi escrito num ficheiro aberto
+ * @param	file	Ficheiro aberto para escrita
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool syncFile(FILE* file)
+{
+	if (file == NULL || fflush(file) != 0)
+	{
+		return false;
+	}
+
+#ifdef _WIN32
+	return _commit(_fileno(file)) == 0;
+#else
+	return fsync(fileno(file)) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Substituir um ficheiro por outro de forma atmica (o ficheiro de destino fica com o contedo antigo ou com o novo, nunca a meio)
+ * @param	source		Nome do ficheiro com o novo contedo (deixa de existir)
+ * @param	destination	Nome do ficheiro substitudo
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+bool replaceFile(char source[], char destination[])
+{
+	if (source == NULL || destination == NULL)
+	{
+		return false;
+	}
+
+#ifdef _WIN32
+	return MoveFileExA(source, destination, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return rename(source, destination) == 0;
+#endif
+}
+
+
+/**
+ * @brief	Obter o conjunto de instrues vetoriais mais largo que o processador e o sistema operativo suportam
+ *
+ * O programa  compilado sem instrues vetoriais obrigatrias, e os ncleos AVX2 e AVX-512 (em ficheiros prprios)
+ * s so chamados se esta funo os indicar. O resultado  detetado uma vez (cpuid e registos guardados pelo sistema)
+ * e reutilizado nas chamadas seguintes.
+ * @return	Conjunto de instrues
+*/
+InstructionSet getInstructionSet()
+{
+	int detected = loadAtomic(&detectedInstructionSet);
+	if (detected != -1)
+	{
+		return (InstructionSet)detected;
+	}
+
+	InstructionSet instructionSet = INSTRUCTION_SET_SCALAR;
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int info[4];
+	__cpuid(info, 0);
+	int maximumLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+
+	// o sistema operativo tem de guardar os registos vetoriais (XMM e YMM; e os de AVX-512) nas trocas de contexto
+	unsigned long long enabledStates = osxsave ? _xgetbv(0) : 0;
+
+	if (maximumLeaf >= 7 && (enabledStates & 0x6) == 0x6)
+	{
+		__cpuidex(info, 7, 0);
+
+		if ((info[1] & (1 << 16)) != 0 && (enabledStates & 0xE6) == 0xE6)
+		{
+			instructionSet = INSTRUCTION_SET_AVX512;
+		}
+		else if ((info[1] & (1 << 5)) != 0)
+		{
+			instructionSet = INSTRUCTION_SET_AVX2;
+		}
+	}
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	// as funes do compilador tambm verificam se o sistema operativo guarda os registos vetoriais
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f"))
+	{
+		instructionSet = INSTRUCTION_SET_AVX512;
+	}
+	else if (__builtin_cpu_supports("avx2"))
+	{
+		instructionSet = INSTRUCTION_SET_AVX2;
+	}
+#endif
+
+	storeAtomic(&detectedInstructionSet, (int)instructionSet);
+
+	return instructionSet;
 }
\ No newline at end of file
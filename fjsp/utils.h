@@ -10,5 +10,15 @@
 #define UTILS 1
 
 bool removeNewLine(char* text);
+long long getCurrentTime();
+Random newRandom(unsigned long long seed);
+unsigned long long nextRandom(Random* random);
+int nextRandom_Int(Random* random, int bound);
+float nextRandom_Float(Random* random);
+bool mapFile(char fileName[], MappedFile* file);
+bool unmapFile(MappedFile* file);
+bool syncFile(FILE* file);
+bool replaceFile(char source[], char destination[]);
+InstructionSet getInstructionSet();
 
 #endif
\ No newline at end of file
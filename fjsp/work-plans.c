@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include "data-types.h"
 #include "lists.h"
+#include "hashing.h"
 
 
 /**
@@ -154,10 +155,12 @@ WorkPlan* sortWorkPlans_ByJob(WorkPlan* head)
 
 /**
  * @brief	Obter todos os planos de trabalhos para um realizar um plano de produo
- * @param	head	Lista de planos de trabalhos
- * @return	Booleano para o resultado da funo (se funcionou ou no)
+ * @param	jobs		Lista de trabalhos
+ * @param	operations	Lista de operaes
+ * @param	table		Tabela hash das execues de operaes (os tempos mnimos vm dos agregados de cada operao)
+ * @return	Lista de planos de trabalhos
 */
-WorkPlan* getAllWorkPlans(Job* jobs, Operation* operations, Execution* executions)
+WorkPlan* getAllWorkPlans(Job* jobs, Operation* operations, ExecutionNode* table[])
 {
 	WorkPlan* workPlans = NULL, * workPlan = NULL;
 	Execution* minExecutions = NULL;
@@ -166,7 +169,7 @@ WorkPlan* getAllWorkPlans(Job* jobs, Operation* operations, Execution* execution
 	while (jobs)
 	{
 		// obter o tempo mnimo para completar um job e as respetivas operaes
-		minTime = getMinTime_ToCompleteJob(operations, executions, jobs->id, &minExecutions);
+		minTime = getMinTime_ToCompleteJob_AtTable(table, operations, jobs->id, &minExecutions);
 
 		while (minExecutions)
 		{
@@ -0,0 +1,348 @@
+/**
+ * @brief	Programa de testes de regresso das funcionalidades de escalonamento, com os dados de exemplo da pasta fjsp/text.
+ * @file	tests.c
+ * @author	Lus Pereira
+ * @date	15/08/2024
+ *
+ * Deve ser executado a partir da pasta tests. Termina com 0 se todas as verificaes passaram.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "data-types.h"
+#include "lists.h"
+#include "hashing.h"
+#include "scheduling.h"
+#include "utils.h"
+
+
+#define TESTS_JOBS_FILENAME "../fjsp/text/jobs.csv"
+#define TESTS_MACHINES_FILENAME "../fjsp/text/machines.csv"
+#define TESTS_OPERATIONS_FILENAME "../fjsp/text/operations.csv"
+#define TESTS_EXECUTIONS_FILENAME "../fjsp/text/executions.csv"
+#define TESTS_ARRIVALS_FILENAME "../fjsp/text/arrivals.csv"
+
+
+// quantidade de verificaes que falharam
+static int failures = 0;
+
+
+#pragma region auxiliares
+
+/**
+ * @brief	Registar o resultado de uma verificao
+ * @param	condition	Resultado da verificao
+ * @param	test		Nome do teste
+ * @param	description	Descrio da verificao
+*/
+static void check(bool condition, char test[], char description[])
+{
+	if (!condition)
+	{
+		printf("  [falhou] %s: %s\n", test, description);
+		failures++;
+	}
+}
+
+
+/**
+ * @brief	Dados de exemplo carregados dos ficheiros .csv
+*/
+typedef struct TestData
+{
+	Job* jobs;
+	Machine* machines;
+	Operation* operations;
+	ExecutionNode* table[HASH_TABLE_SIZE];
+	Instance* instance;
+	Schedule* schedule;
+} TestData;
+
+
+/**
+ * @brief	Carregar os dados de exemplo e construir a instncia e um plano pela regra gulosa
+ * @param	data	Dados a preencher
+ * @return	Booleano para o resultado da funo (se funcionou ou no)
+*/
+static bool loadTestData(TestData* data)
+{
+	for (int i = 0; i < HASH_TABLE_SIZE; i++)
+	{
+		data->table[i] = NULL;
+	}
+
+	data->jobs = readJobs_Text(TESTS_JOBS_FILENAME);
+	data->machines = readMachines_Text(TESTS_MACHINES_FILENAME);
+	data->operations = readOperations_Text(TESTS_OPERATIONS_FILENAME);
+	*data->table = readExecutions_AtTable_Text(TESTS_EXECUTIONS_FILENAME, data->table, NULL);
+	data->instance = newInstance(data->jobs, data->machines, data->operations, data->table);
+	data->schedule = data->instance != NULL ? newSchedule(data->instance) : NULL;
+
+	return data->schedule != NULL && buildSchedule_Greedy(data->instance, data->schedule) >= 0;
+}
+
+
+/**
+ * @brief	Libertar os dados de exemplo
+ * @param	data	Dados carregados por loadTestData
+*/
+static void cleanTestData(TestData* data)
+{
+	cleanSchedule(&data->schedule);
+	cleanInstance(&data->instance);
+	cleanJobs(&data->jobs);
+	cleanMachines(&data->machines);
+	cleanOperations(&data->operations);
+	cleanExecutions_Table(&data->table);
+}
+
+
+/**
+ * @brief	Verificar se um plano avaliado tem os mesmos tempos que uma avaliao de raiz de uma cpia
+ * @param	instance	Instncia do problema
+ * @param	schedule	Plano
+ * @return	Booleano para o resultado da funo (se os tempos coincidem ou no)
+*/
+static bool isScheduleConsistent(Instance* instance, Schedule* schedule)
+{
+	Schedule* copy = newSchedule(instance);
+	bool consistent = copy != NULL && copySchedule(copy, schedule) && evaluateSchedule(instance, copy) == schedule->makespan;
+
+	for (int o = 0; consistent && o < instance->numberOfOperations; o++)
+	{
+		consistent = copy->startTime[o] == schedule->startTime[o] && copy->endTime[o] == schedule->endTime[o];
+	}
+
+	cleanSchedule(&copy);
+
+	return consistent;
+}
+
+#pragma endregion
+
+
+#pragma region testes
+
+/**
+ * @brief	Inserir os novos trabalhos no plano (escalonamento online) e depois reparar o plano com polimento
+ *
+ * A ordem topolgica do plano tem de incluir as operaes inseridas, porque o polimento usa as caudas do plano.
+*/
+static void testOnline_ThenRepair()
+{
+	char test[] = "online e reparao";
+	TestData data;
+
+	check(loadTestData(&data), test, "carregar os dados");
+
+	int numberOfOperations = data.instance->numberOfOperations;
+	OnlineScheduler* online = startOnlineScheduler(data.instance, data.schedule, NULL, NULL);
+	int numberOfArrivals = readArrivals_Online(online, TESTS_ARRIVALS_FILENAME);
+	cleanOnlineScheduler(&online);
+
+	check(numberOfArrivals == 2, test, "inserir os 2 trabalhos do ficheiro");
+	check(data.schedule->numberOfScheduled == data.instance->numberOfOperations, test, "escalonar todas as operaes inseridas");
+	check(isScheduleConsistent(data.instance, data.schedule), test, "plano consistente depois da insero");
+
+	// alterar o tempo de execuo da primeira operao inserida na mquina atribuda, com polimento
+	int operation = numberOfOperations;
+	int machineID = data.instance->machineIDs[data.schedule->assignedMachine[operation]];
+	int makespan = repairSchedule_Runtime(data.instance, data.schedule, data.instance->operationIDs[operation], machineID,
+		data.schedule->assignedRuntime[operation] + 7, true);
+
+	check(makespan >= 0, test, "reparar o plano");
+	check(isScheduleConsistent(data.instance, data.schedule), test, "plano consistente depois da reparao");
+
+	cleanTestData(&data);
+}
+
+
+/**
+ * @brief	Inserir os novos trabalhos duas vezes: na segunda, os identificadores j existem e nenhum trabalho  inserido
+*/
+static void testOnline_Duplicated()
+{
+	char test[] = "online com identificadores repetidos";
+	TestData data;
+
+	check(loadTestData(&data), test, "carregar os dados");
+
+	OnlineScheduler* online = startOnlineScheduler(data.instance, data.schedule, NULL, NULL);
+	readArrivals_Online(online, TESTS_ARRIVALS_FILENAME);
+
+	int numberOfJobs = data.instance->numberOfJobs;
+	int numberOfOperations = data.instance->numberOfOperations;
+	int makespan = data.schedule->makespan;
+
+	check(readArrivals_Online(online, TESTS_ARRIVALS_FILENAME) == 0, test, "recusar os trabalhos repetidos");
+	check(data.instance->numberOfJobs == numberOfJobs && data.instance->numberOfOperations == numberOfOperations, test, "manter a instncia");
+	check(data.schedule->makespan == makespan && isScheduleConsistent(data.instance, data.schedule), test, "manter o plano");
+
+	// uma operao com a mesma mquina duas vezes tambm  recusada
+	int operationIDs[] = { 900 };
+	int eligibleStart[] = { 0, 2 };
+	int machineIDs[] = { data.instance->machineIDs[0], data.instance->machineIDs[0] };
+	int runtimes[] = { 3, 4 };
+	JobArrival arrival = { 900, 0, 1, operationIDs, eligibleStart, machineIDs, runtimes };
+
+	check(insertJob_Online(online, &arrival) == -1, test, "recusar mquinas repetidas numa operao");
+	check(data.instance->numberOfOperations == numberOfOperations, test, "manter a instncia depois da recusa");
+
+	cleanOnlineScheduler(&online);
+	cleanTestData(&data);
+}
+
+
+/**
+ * @brief	Reparar um plano melhorado depois de alterar tempos de execuo e depois de remover uma mquina
+*/
+static void testRepair()
+{
+	char test[] = "reparao";
+	TestData data;
+
+	check(loadTestData(&data), test, "carregar os dados");
+	check(solveSchedule_IteratedGreedy(data.instance, data.schedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, 0, 200, 1) >= 0, test,
+		"melhorar o plano");
+
+	// tempos de execuo maiores e menores, sem polimento: o plano reparado tem de ser igual a uma avaliao de raiz
+	for (int o = 0; o < data.instance->numberOfOperations; o += 3)
+	{
+		int machineID = data.instance->machineIDs[data.schedule->assignedMachine[o]];
+		int runtime = o % 2 == 0 ? data.schedule->assignedRuntime[o] + 5 : 1;
+		int makespan = repairSchedule_Runtime(data.instance, data.schedule, data.instance->operationIDs[o], machineID, runtime, false);
+
+		check(makespan >= 0 && data.schedule->assignedRuntime[o] == runtime, test, "alterar o tempo de execuo");
+		check(isScheduleConsistent(data.instance, data.schedule), test, "plano consistente depois de alterar o tempo de execuo");
+	}
+
+	// remover a mquina da primeira operao a meio do plano
+	Schedule* before = newSchedule(data.instance);
+	check(before != NULL && copySchedule(before, data.schedule), test, "copiar o plano");
+
+	int machine = data.schedule->assignedMachine[0];
+	int failureTime = data.schedule->makespan / 2;
+	int makespan = repairSchedule_MachineRemoval(data.instance, data.schedule, data.instance->machineIDs[machine], failureTime);
+
+	check(makespan >= 0, test, "remover a mquina");
+	check(isScheduleConsistent(data.instance, data.schedule), test, "plano consistente depois de remover a mquina");
+
+	for (int o = 0; makespan >= 0 && o < data.instance->numberOfOperations; o++)
+	{
+		if (before->endTime[o] <= failureTime)
+		{
+			check(data.schedule->assignedMachine[o] == before->assignedMachine[o] && data.schedule->startTime[o] == before->startTime[o], test,
+				"manter as operaes que terminaram antes da avaria");
+		}
+		else
+		{
+			check(data.schedule->assignedMachine[o] != machine, test, "reatribuir as operaes que no terminaram antes da avaria");
+		}
+
+		check(data.schedule->startTime[o] >= before->startTime[o], test, "no antecipar operaes");
+	}
+
+	cleanSchedule(&before);
+	cleanTestData(&data);
+}
+
+
+/**
+ * @brief	Codificar um plano como cromossoma e descodific-lo, e avaliar cromossomas em lote (mais do que DECODE_LANES, com mutaes)
+*/
+static void testEncode_Decode()
+{
+	char test[] = "codificao e descodificao";
+	TestData data;
+
+	check(loadTestData(&data), test, "carregar os dados");
+	check(solveSchedule_IteratedGreedy(data.instance, data.schedule, ITERATED_GREEDY_DESTROY_SIZE, ITERATED_GREEDY_TEMPERATURE, 0, 200, 2) >= 0, test,
+		"melhorar o plano");
+
+	int n = data.instance->numberOfOperations;
+	int count = DECODE_LANES + 4;
+	int** assignments = (int**)calloc(count, sizeof(int*));
+	int** sequences = (int**)calloc(count, sizeof(int*));
+	int* makespans = (int*)malloc(count * sizeof(int));
+	unsigned long long* fingerprints = (unsigned long long*)malloc(count * sizeof(unsigned long long));
+	Schedule* decoded = newSchedule(data.instance);
+	bool allocated = assignments != NULL && sequences != NULL && makespans != NULL && fingerprints != NULL && decoded != NULL;
+
+	for (int i = 0; allocated && i < count; i++)
+	{
+		assignments[i] = (int*)malloc(n * sizeof(int));
+		sequences[i] = (int*)malloc(n * sizeof(int));
+		allocated = assignments[i] != NULL && sequences[i] != NULL;
+	}
+
+	check(allocated, test, "alocar os cromossomas");
+
+	if (allocated)
+	{
+		// o cromossoma do plano volta a construir o mesmo plano
+		check(encodeSchedule(data.instance, data.schedule, assignments[0], sequences[0]), test, "codificar o plano");
+		check(buildSchedule_Decoded(data.instance, decoded, assignments[0], sequences[0], 0, NULL, NULL) == data.schedule->makespan, test,
+			"descodificar com o mesmo tempo total");
+
+		bool same = decoded->fingerprint == data.schedule->fingerprint;
+		for (int o = 0; same && o < n; o++)
+		{
+			same = decoded->assignedMachine[o] == data.schedule->assignedMachine[o] && decoded->startTime[o] == data.schedule->startTime[o];
+		}
+
+		check(same, test, "descodificar o mesmo plano");
+
+		// os restantes cromossomas so mutaes do anterior
+		Random random = newRandom(3);
+		for (int i = 1; i < count; i++)
+		{
+			memcpy(assignments[i], assignments[i - 1], n * sizeof(int));
+			memcpy(sequences[i], sequences[i - 1], n * sizeof(int));
+			mutateChromosome(data.instance, assignments[i], sequences[i], &random);
+		}
+
+		check(evaluateChromosomes_Batch(data.instance, assignments, sequences, count, makespans, fingerprints), test, "avaliar em lote");
+
+		for (int i = 0; i < count; i++)
+		{
+			int makespan = buildSchedule_Decoded(data.instance, decoded, assignments[i], sequences[i], 0, NULL, NULL);
+
+			check(makespans[i] == makespan && fingerprints[i] == decoded->fingerprint, test, "avaliao em lote igual  descodificao");
+		}
+	}
+
+	for (int i = 0; i < count && assignments != NULL && sequences != NULL; i++)
+	{
+		free(assignments[i]);
+		free(sequences[i]);
+	}
+
+	free(assignments);
+	free(sequences);
+	free(makespans);
+	free(fingerprints);
+	cleanSchedule(&decoded);
+	cleanTestData(&data);
+}
+
+#pragma endregion
+
+
+/**
+ * @brief	Executar todos os testes
+ * @return	0 se todas as verificaes passaram (ou 1 se alguma falhou)
+*/
+int main()
+{
+	printf("Testes de regresso\n");
+
+	testOnline_ThenRepair();
+	testOnline_Duplicated();
+	testRepair();
+	testEncode_Decode();
+
+	printf("%s (%d verificaes falharam)\n", failures == 0 ? "Todos os testes passaram" : "Existem testes que falharam", failures);
+
+	return failures == 0 ? 0 : 1;
+}
\ No newline at end of file